@@ -0,0 +1,79 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ancestor_filter.cpp" "CMakeFiles/litehtml.dir/src/ancestor_filter.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/ancestor_filter.cpp.o.d"
+  "/root/repo/src/codepoint.cpp" "CMakeFiles/litehtml.dir/src/codepoint.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/codepoint.cpp.o.d"
+  "/root/repo/src/css_borders.cpp" "CMakeFiles/litehtml.dir/src/css_borders.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/css_borders.cpp.o.d"
+  "/root/repo/src/css_length.cpp" "CMakeFiles/litehtml.dir/src/css_length.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/css_length.cpp.o.d"
+  "/root/repo/src/css_properties.cpp" "CMakeFiles/litehtml.dir/src/css_properties.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/css_properties.cpp.o.d"
+  "/root/repo/src/css_selector.cpp" "CMakeFiles/litehtml.dir/src/css_selector.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/css_selector.cpp.o.d"
+  "/root/repo/src/display_list.cpp" "CMakeFiles/litehtml.dir/src/display_list.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/display_list.cpp.o.d"
+  "/root/repo/src/document.cpp" "CMakeFiles/litehtml.dir/src/document.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/document.cpp.o.d"
+  "/root/repo/src/document_builder.cpp" "CMakeFiles/litehtml.dir/src/document_builder.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/document_builder.cpp.o.d"
+  "/root/repo/src/document_container.cpp" "CMakeFiles/litehtml.dir/src/document_container.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/document_container.cpp.o.d"
+  "/root/repo/src/el_anchor.cpp" "CMakeFiles/litehtml.dir/src/el_anchor.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_anchor.cpp.o.d"
+  "/root/repo/src/el_base.cpp" "CMakeFiles/litehtml.dir/src/el_base.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_base.cpp.o.d"
+  "/root/repo/src/el_before_after.cpp" "CMakeFiles/litehtml.dir/src/el_before_after.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_before_after.cpp.o.d"
+  "/root/repo/src/el_body.cpp" "CMakeFiles/litehtml.dir/src/el_body.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_body.cpp.o.d"
+  "/root/repo/src/el_break.cpp" "CMakeFiles/litehtml.dir/src/el_break.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_break.cpp.o.d"
+  "/root/repo/src/el_cdata.cpp" "CMakeFiles/litehtml.dir/src/el_cdata.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_cdata.cpp.o.d"
+  "/root/repo/src/el_comment.cpp" "CMakeFiles/litehtml.dir/src/el_comment.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_comment.cpp.o.d"
+  "/root/repo/src/el_div.cpp" "CMakeFiles/litehtml.dir/src/el_div.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_div.cpp.o.d"
+  "/root/repo/src/el_font.cpp" "CMakeFiles/litehtml.dir/src/el_font.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_font.cpp.o.d"
+  "/root/repo/src/el_image.cpp" "CMakeFiles/litehtml.dir/src/el_image.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_image.cpp.o.d"
+  "/root/repo/src/el_link.cpp" "CMakeFiles/litehtml.dir/src/el_link.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_link.cpp.o.d"
+  "/root/repo/src/el_para.cpp" "CMakeFiles/litehtml.dir/src/el_para.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_para.cpp.o.d"
+  "/root/repo/src/el_script.cpp" "CMakeFiles/litehtml.dir/src/el_script.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_script.cpp.o.d"
+  "/root/repo/src/el_space.cpp" "CMakeFiles/litehtml.dir/src/el_space.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_space.cpp.o.d"
+  "/root/repo/src/el_style.cpp" "CMakeFiles/litehtml.dir/src/el_style.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_style.cpp.o.d"
+  "/root/repo/src/el_table.cpp" "CMakeFiles/litehtml.dir/src/el_table.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_table.cpp.o.d"
+  "/root/repo/src/el_td.cpp" "CMakeFiles/litehtml.dir/src/el_td.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_td.cpp.o.d"
+  "/root/repo/src/el_text.cpp" "CMakeFiles/litehtml.dir/src/el_text.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_text.cpp.o.d"
+  "/root/repo/src/el_title.cpp" "CMakeFiles/litehtml.dir/src/el_title.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_title.cpp.o.d"
+  "/root/repo/src/el_tr.cpp" "CMakeFiles/litehtml.dir/src/el_tr.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/el_tr.cpp.o.d"
+  "/root/repo/src/element.cpp" "CMakeFiles/litehtml.dir/src/element.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/element.cpp.o.d"
+  "/root/repo/src/font_cache.cpp" "CMakeFiles/litehtml.dir/src/font_cache.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/font_cache.cpp.o.d"
+  "/root/repo/src/formatting_context.cpp" "CMakeFiles/litehtml.dir/src/formatting_context.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/formatting_context.cpp.o.d"
+  "/root/repo/src/html.cpp" "CMakeFiles/litehtml.dir/src/html.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/html.cpp.o.d"
+  "/root/repo/src/html_tag.cpp" "CMakeFiles/litehtml.dir/src/html_tag.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/html_tag.cpp.o.d"
+  "/root/repo/src/iterators.cpp" "CMakeFiles/litehtml.dir/src/iterators.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/iterators.cpp.o.d"
+  "/root/repo/src/line_box.cpp" "CMakeFiles/litehtml.dir/src/line_box.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/line_box.cpp.o.d"
+  "/root/repo/src/media_query.cpp" "CMakeFiles/litehtml.dir/src/media_query.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/media_query.cpp.o.d"
+  "/root/repo/src/num_cvt.cpp" "CMakeFiles/litehtml.dir/src/num_cvt.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/num_cvt.cpp.o.d"
+  "/root/repo/src/object_pool.cpp" "CMakeFiles/litehtml.dir/src/object_pool.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/object_pool.cpp.o.d"
+  "/root/repo/src/render_block.cpp" "CMakeFiles/litehtml.dir/src/render_block.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/render_block.cpp.o.d"
+  "/root/repo/src/render_block_context.cpp" "CMakeFiles/litehtml.dir/src/render_block_context.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/render_block_context.cpp.o.d"
+  "/root/repo/src/render_flex.cpp" "CMakeFiles/litehtml.dir/src/render_flex.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/render_flex.cpp.o.d"
+  "/root/repo/src/render_image.cpp" "CMakeFiles/litehtml.dir/src/render_image.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/render_image.cpp.o.d"
+  "/root/repo/src/render_inline_context.cpp" "CMakeFiles/litehtml.dir/src/render_inline_context.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/render_inline_context.cpp.o.d"
+  "/root/repo/src/render_item.cpp" "CMakeFiles/litehtml.dir/src/render_item.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/render_item.cpp.o.d"
+  "/root/repo/src/render_table.cpp" "CMakeFiles/litehtml.dir/src/render_table.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/render_table.cpp.o.d"
+  "/root/repo/src/string_id.cpp" "CMakeFiles/litehtml.dir/src/string_id.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/string_id.cpp.o.d"
+  "/root/repo/src/strtod.cpp" "CMakeFiles/litehtml.dir/src/strtod.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/strtod.cpp.o.d"
+  "/root/repo/src/style.cpp" "CMakeFiles/litehtml.dir/src/style.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/style.cpp.o.d"
+  "/root/repo/src/style_sharing_cache.cpp" "CMakeFiles/litehtml.dir/src/style_sharing_cache.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/style_sharing_cache.cpp.o.d"
+  "/root/repo/src/stylesheet.cpp" "CMakeFiles/litehtml.dir/src/stylesheet.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/stylesheet.cpp.o.d"
+  "/root/repo/src/stylesheet_cache.cpp" "CMakeFiles/litehtml.dir/src/stylesheet_cache.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/stylesheet_cache.cpp.o.d"
+  "/root/repo/src/table.cpp" "CMakeFiles/litehtml.dir/src/table.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/table.cpp.o.d"
+  "/root/repo/src/text_width_cache.cpp" "CMakeFiles/litehtml.dir/src/text_width_cache.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/text_width_cache.cpp.o.d"
+  "/root/repo/src/tstring_view.cpp" "CMakeFiles/litehtml.dir/src/tstring_view.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/tstring_view.cpp.o.d"
+  "/root/repo/src/url.cpp" "CMakeFiles/litehtml.dir/src/url.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/url.cpp.o.d"
+  "/root/repo/src/url_path.cpp" "CMakeFiles/litehtml.dir/src/url_path.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/url_path.cpp.o.d"
+  "/root/repo/src/utf8_strings.cpp" "CMakeFiles/litehtml.dir/src/utf8_strings.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/utf8_strings.cpp.o.d"
+  "/root/repo/src/web_color.cpp" "CMakeFiles/litehtml.dir/src/web_color.cpp.o" "gcc" "CMakeFiles/litehtml.dir/src/web_color.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/src/gumbo/CMakeFiles/gumbo.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,129 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/litehtml.dir/src/ancestor_filter.cpp.o"
+  "CMakeFiles/litehtml.dir/src/ancestor_filter.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/codepoint.cpp.o"
+  "CMakeFiles/litehtml.dir/src/codepoint.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/css_borders.cpp.o"
+  "CMakeFiles/litehtml.dir/src/css_borders.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/css_length.cpp.o"
+  "CMakeFiles/litehtml.dir/src/css_length.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/css_properties.cpp.o"
+  "CMakeFiles/litehtml.dir/src/css_properties.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/css_selector.cpp.o"
+  "CMakeFiles/litehtml.dir/src/css_selector.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/display_list.cpp.o"
+  "CMakeFiles/litehtml.dir/src/display_list.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/document.cpp.o"
+  "CMakeFiles/litehtml.dir/src/document.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/document_builder.cpp.o"
+  "CMakeFiles/litehtml.dir/src/document_builder.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/document_container.cpp.o"
+  "CMakeFiles/litehtml.dir/src/document_container.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_anchor.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_anchor.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_base.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_base.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_before_after.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_before_after.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_body.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_body.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_break.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_break.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_cdata.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_cdata.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_comment.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_comment.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_div.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_div.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_font.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_font.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_image.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_image.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_link.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_link.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_para.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_para.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_script.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_script.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_space.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_space.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_style.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_style.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_table.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_table.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_td.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_td.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_text.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_text.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_title.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_title.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/el_tr.cpp.o"
+  "CMakeFiles/litehtml.dir/src/el_tr.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/element.cpp.o"
+  "CMakeFiles/litehtml.dir/src/element.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/font_cache.cpp.o"
+  "CMakeFiles/litehtml.dir/src/font_cache.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/formatting_context.cpp.o"
+  "CMakeFiles/litehtml.dir/src/formatting_context.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/html.cpp.o"
+  "CMakeFiles/litehtml.dir/src/html.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/html_tag.cpp.o"
+  "CMakeFiles/litehtml.dir/src/html_tag.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/iterators.cpp.o"
+  "CMakeFiles/litehtml.dir/src/iterators.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/line_box.cpp.o"
+  "CMakeFiles/litehtml.dir/src/line_box.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/media_query.cpp.o"
+  "CMakeFiles/litehtml.dir/src/media_query.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/num_cvt.cpp.o"
+  "CMakeFiles/litehtml.dir/src/num_cvt.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/object_pool.cpp.o"
+  "CMakeFiles/litehtml.dir/src/object_pool.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/render_block.cpp.o"
+  "CMakeFiles/litehtml.dir/src/render_block.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/render_block_context.cpp.o"
+  "CMakeFiles/litehtml.dir/src/render_block_context.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/render_flex.cpp.o"
+  "CMakeFiles/litehtml.dir/src/render_flex.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/render_image.cpp.o"
+  "CMakeFiles/litehtml.dir/src/render_image.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/render_inline_context.cpp.o"
+  "CMakeFiles/litehtml.dir/src/render_inline_context.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/render_item.cpp.o"
+  "CMakeFiles/litehtml.dir/src/render_item.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/render_table.cpp.o"
+  "CMakeFiles/litehtml.dir/src/render_table.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/string_id.cpp.o"
+  "CMakeFiles/litehtml.dir/src/string_id.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/strtod.cpp.o"
+  "CMakeFiles/litehtml.dir/src/strtod.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/style.cpp.o"
+  "CMakeFiles/litehtml.dir/src/style.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/style_sharing_cache.cpp.o"
+  "CMakeFiles/litehtml.dir/src/style_sharing_cache.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/stylesheet.cpp.o"
+  "CMakeFiles/litehtml.dir/src/stylesheet.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/stylesheet_cache.cpp.o"
+  "CMakeFiles/litehtml.dir/src/stylesheet_cache.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/table.cpp.o"
+  "CMakeFiles/litehtml.dir/src/table.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/text_width_cache.cpp.o"
+  "CMakeFiles/litehtml.dir/src/text_width_cache.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/tstring_view.cpp.o"
+  "CMakeFiles/litehtml.dir/src/tstring_view.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/url.cpp.o"
+  "CMakeFiles/litehtml.dir/src/url.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/url_path.cpp.o"
+  "CMakeFiles/litehtml.dir/src/url_path.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/utf8_strings.cpp.o"
+  "CMakeFiles/litehtml.dir/src/utf8_strings.cpp.o.d"
+  "CMakeFiles/litehtml.dir/src/web_color.cpp.o"
+  "CMakeFiles/litehtml.dir/src/web_color.cpp.o.d"
+  "liblitehtml.a"
+  "liblitehtml.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/litehtml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
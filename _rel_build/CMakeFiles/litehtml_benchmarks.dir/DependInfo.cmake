@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/containers/test/Bitmap.cpp" "CMakeFiles/litehtml_benchmarks.dir/containers/test/Bitmap.cpp.o" "gcc" "CMakeFiles/litehtml_benchmarks.dir/containers/test/Bitmap.cpp.o.d"
+  "/root/repo/containers/test/Font.cpp" "CMakeFiles/litehtml_benchmarks.dir/containers/test/Font.cpp.o" "gcc" "CMakeFiles/litehtml_benchmarks.dir/containers/test/Font.cpp.o.d"
+  "/root/repo/containers/test/lodepng.cpp" "CMakeFiles/litehtml_benchmarks.dir/containers/test/lodepng.cpp.o" "gcc" "CMakeFiles/litehtml_benchmarks.dir/containers/test/lodepng.cpp.o.d"
+  "/root/repo/containers/test/test_container.cpp" "CMakeFiles/litehtml_benchmarks.dir/containers/test/test_container.cpp.o" "gcc" "CMakeFiles/litehtml_benchmarks.dir/containers/test/test_container.cpp.o.d"
+  "/root/repo/test/benchmarks.cpp" "CMakeFiles/litehtml_benchmarks.dir/test/benchmarks.cpp.o" "gcc" "CMakeFiles/litehtml_benchmarks.dir/test/benchmarks.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/litehtml.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/gumbo/CMakeFiles/gumbo.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/litehtml_benchmarks.dir/containers/test/Bitmap.cpp.o"
+  "CMakeFiles/litehtml_benchmarks.dir/containers/test/Bitmap.cpp.o.d"
+  "CMakeFiles/litehtml_benchmarks.dir/containers/test/Font.cpp.o"
+  "CMakeFiles/litehtml_benchmarks.dir/containers/test/Font.cpp.o.d"
+  "CMakeFiles/litehtml_benchmarks.dir/containers/test/lodepng.cpp.o"
+  "CMakeFiles/litehtml_benchmarks.dir/containers/test/lodepng.cpp.o.d"
+  "CMakeFiles/litehtml_benchmarks.dir/containers/test/test_container.cpp.o"
+  "CMakeFiles/litehtml_benchmarks.dir/containers/test/test_container.cpp.o.d"
+  "CMakeFiles/litehtml_benchmarks.dir/test/benchmarks.cpp.o"
+  "CMakeFiles/litehtml_benchmarks.dir/test/benchmarks.cpp.o.d"
+  "litehtml_benchmarks"
+  "litehtml_benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/litehtml_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/containers/test/Bitmap.cpp" "CMakeFiles/litehtml_tests.dir/containers/test/Bitmap.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/containers/test/Bitmap.cpp.o.d"
+  "/root/repo/containers/test/Font.cpp" "CMakeFiles/litehtml_tests.dir/containers/test/Font.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/containers/test/Font.cpp.o.d"
+  "/root/repo/containers/test/lodepng.cpp" "CMakeFiles/litehtml_tests.dir/containers/test/lodepng.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/containers/test/lodepng.cpp.o.d"
+  "/root/repo/containers/test/test_container.cpp" "CMakeFiles/litehtml_tests.dir/containers/test/test_container.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/containers/test/test_container.cpp.o.d"
+  "/root/repo/test/codepoint_test.cpp" "CMakeFiles/litehtml_tests.dir/test/codepoint_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/codepoint_test.cpp.o.d"
+  "/root/repo/test/cssTest.cpp" "CMakeFiles/litehtml_tests.dir/test/cssTest.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/cssTest.cpp.o.d"
+  "/root/repo/test/display_list_test.cpp" "CMakeFiles/litehtml_tests.dir/test/display_list_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/display_list_test.cpp.o.d"
+  "/root/repo/test/document_builder_test.cpp" "CMakeFiles/litehtml_tests.dir/test/document_builder_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/document_builder_test.cpp.o.d"
+  "/root/repo/test/document_test.cpp" "CMakeFiles/litehtml_tests.dir/test/document_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/document_test.cpp.o.d"
+  "/root/repo/test/font_cache_test.cpp" "CMakeFiles/litehtml_tests.dir/test/font_cache_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/font_cache_test.cpp.o.d"
+  "/root/repo/test/mediaQueryTest.cpp" "CMakeFiles/litehtml_tests.dir/test/mediaQueryTest.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/mediaQueryTest.cpp.o.d"
+  "/root/repo/test/object_pool_test.cpp" "CMakeFiles/litehtml_tests.dir/test/object_pool_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/object_pool_test.cpp.o.d"
+  "/root/repo/test/render_test.cpp" "CMakeFiles/litehtml_tests.dir/test/render_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/render_test.cpp.o.d"
+  "/root/repo/test/split_text_test.cpp" "CMakeFiles/litehtml_tests.dir/test/split_text_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/split_text_test.cpp.o.d"
+  "/root/repo/test/string_id_test.cpp" "CMakeFiles/litehtml_tests.dir/test/string_id_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/string_id_test.cpp.o.d"
+  "/root/repo/test/stylesheet_cache_test.cpp" "CMakeFiles/litehtml_tests.dir/test/stylesheet_cache_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/stylesheet_cache_test.cpp.o.d"
+  "/root/repo/test/text_width_cache_test.cpp" "CMakeFiles/litehtml_tests.dir/test/text_width_cache_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/text_width_cache_test.cpp.o.d"
+  "/root/repo/test/thread_test.cpp" "CMakeFiles/litehtml_tests.dir/test/thread_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/thread_test.cpp.o.d"
+  "/root/repo/test/tstring_view_test.cpp" "CMakeFiles/litehtml_tests.dir/test/tstring_view_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/tstring_view_test.cpp.o.d"
+  "/root/repo/test/url_path_test.cpp" "CMakeFiles/litehtml_tests.dir/test/url_path_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/url_path_test.cpp.o.d"
+  "/root/repo/test/url_test.cpp" "CMakeFiles/litehtml_tests.dir/test/url_test.cpp.o" "gcc" "CMakeFiles/litehtml_tests.dir/test/url_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel_build/CMakeFiles/litehtml.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/src/gumbo/CMakeFiles/gumbo.dir/DependInfo.cmake"
+  "/root/repo/_rel_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
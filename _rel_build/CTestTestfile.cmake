@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_rel_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_rel_build/litehtml_tests[1]_include.cmake")
+subdirs("src/gumbo")
+subdirs("_deps/googletest-build")
@@ -0,0 +1,166 @@
+# Install script for directory: /root/repo
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "libraries" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_rel_build/liblitehtml.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/litehtml" TYPE FILE FILES
+    "/root/repo/include/litehtml.h"
+    "/root/repo/include/litehtml/background.h"
+    "/root/repo/include/litehtml/borders.h"
+    "/root/repo/include/litehtml/codepoint.h"
+    "/root/repo/include/litehtml/css_length.h"
+    "/root/repo/include/litehtml/css_margins.h"
+    "/root/repo/include/litehtml/css_offsets.h"
+    "/root/repo/include/litehtml/css_position.h"
+    "/root/repo/include/litehtml/css_selector.h"
+    "/root/repo/include/litehtml/document.h"
+    "/root/repo/include/litehtml/document_container.h"
+    "/root/repo/include/litehtml/el_anchor.h"
+    "/root/repo/include/litehtml/el_base.h"
+    "/root/repo/include/litehtml/el_before_after.h"
+    "/root/repo/include/litehtml/el_body.h"
+    "/root/repo/include/litehtml/el_break.h"
+    "/root/repo/include/litehtml/el_cdata.h"
+    "/root/repo/include/litehtml/el_comment.h"
+    "/root/repo/include/litehtml/el_div.h"
+    "/root/repo/include/litehtml/el_font.h"
+    "/root/repo/include/litehtml/el_image.h"
+    "/root/repo/include/litehtml/el_link.h"
+    "/root/repo/include/litehtml/el_para.h"
+    "/root/repo/include/litehtml/el_script.h"
+    "/root/repo/include/litehtml/el_space.h"
+    "/root/repo/include/litehtml/el_style.h"
+    "/root/repo/include/litehtml/el_table.h"
+    "/root/repo/include/litehtml/el_td.h"
+    "/root/repo/include/litehtml/el_text.h"
+    "/root/repo/include/litehtml/el_title.h"
+    "/root/repo/include/litehtml/el_tr.h"
+    "/root/repo/include/litehtml/element.h"
+    "/root/repo/include/litehtml/html.h"
+    "/root/repo/include/litehtml/html_tag.h"
+    "/root/repo/include/litehtml/iterators.h"
+    "/root/repo/include/litehtml/media_query.h"
+    "/root/repo/include/litehtml/os_types.h"
+    "/root/repo/include/litehtml/style.h"
+    "/root/repo/include/litehtml/stylesheet.h"
+    "/root/repo/include/litehtml/table.h"
+    "/root/repo/include/litehtml/tstring_view.h"
+    "/root/repo/include/litehtml/types.h"
+    "/root/repo/include/litehtml/url.h"
+    "/root/repo/include/litehtml/url_path.h"
+    "/root/repo/include/litehtml/utf8_strings.h"
+    "/root/repo/include/litehtml/web_color.h"
+    "/root/repo/include/litehtml/num_cvt.h"
+    "/root/repo/include/litehtml/css_properties.h"
+    "/root/repo/include/litehtml/line_box.h"
+    "/root/repo/include/litehtml/render_item.h"
+    "/root/repo/include/litehtml/render_flex.h"
+    "/root/repo/include/litehtml/render_image.h"
+    "/root/repo/include/litehtml/render_inline.h"
+    "/root/repo/include/litehtml/render_table.h"
+    "/root/repo/include/litehtml/render_inline_context.h"
+    "/root/repo/include/litehtml/render_block_context.h"
+    "/root/repo/include/litehtml/render_block.h"
+    "/root/repo/include/litehtml/master_css.h"
+    "/root/repo/include/litehtml/string_id.h"
+    "/root/repo/include/litehtml/formatting_context.h"
+    "/root/repo/include/litehtml/ancestor_filter.h"
+    "/root/repo/include/litehtml/style_sharing_cache.h"
+    "/root/repo/include/litehtml/document_builder.h"
+    "/root/repo/include/litehtml/stylesheet_cache.h"
+    "/root/repo/include/litehtml/object_pool.h"
+    "/root/repo/include/litehtml/display_list.h"
+    "/root/repo/include/litehtml/text_width_cache.h"
+    "/root/repo/include/litehtml/font_cache.h"
+    "/root/repo/include/litehtml/render_text.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/litehtml" TYPE FILE FILES "/root/repo/cmake/litehtmlConfig.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/litehtml/litehtmlTargets.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/litehtml/litehtmlTargets.cmake"
+         "/root/repo/_rel_build/CMakeFiles/Export/1858d3296707c77b4f85418fd0121701/litehtmlTargets.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/litehtml/litehtmlTargets-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/litehtml/litehtmlTargets.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/litehtml" TYPE FILE FILES "/root/repo/_rel_build/CMakeFiles/Export/1858d3296707c77b4f85418fd0121701/litehtmlTargets.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee])$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/litehtml" TYPE FILE FILES "/root/repo/_rel_build/CMakeFiles/Export/1858d3296707c77b4f85418fd0121701/litehtmlTargets-release.cmake")
+  endif()
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_rel_build/src/gumbo/cmake_install.cmake")
+  include("/root/repo/_rel_build/_deps/googletest-build/cmake_install.cmake")
+
+endif()
+
+if(CMAKE_INSTALL_COMPONENT)
+  set(CMAKE_INSTALL_MANIFEST "install_manifest_${CMAKE_INSTALL_COMPONENT}.txt")
+else()
+  set(CMAKE_INSTALL_MANIFEST "install_manifest.txt")
+endif()
+
+string(REPLACE ";" "\n" CMAKE_INSTALL_MANIFEST_CONTENT
+       "${CMAKE_INSTALL_MANIFEST_FILES}")
+file(WRITE "/root/repo/_rel_build/${CMAKE_INSTALL_MANIFEST}"
+     "${CMAKE_INSTALL_MANIFEST_CONTENT}")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_rel_build/litehtml_tests[1]_tests.cmake")
+  include("/root/repo/_rel_build/litehtml_tests[1]_tests.cmake")
+else()
+  add_test(litehtml_tests_NOT_BUILT litehtml_tests_NOT_BUILT)
+endif()
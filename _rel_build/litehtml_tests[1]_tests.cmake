@@ -0,0 +1,195 @@
+add_test([=[CSSTest.Url]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=CSSTest.Url]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSSTest.Url]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSSTest.LengthParse]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=CSSTest.LengthParse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSSTest.LengthParse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSSTest.ElementSelectorParse]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=CSSTest.ElementSelectorParse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSSTest.ElementSelectorParse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSSTest.SharedStylesheet]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=CSSTest.SharedStylesheet]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSSTest.SharedStylesheet]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[MediaQueryTest.Check]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=MediaQueryTest.Check]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[MediaQueryTest.Check]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CodepointTest.URLReserved]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=CodepointTest.URLReserved]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CodepointTest.URLReserved]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CodepointTest.URLScheme]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=CodepointTest.URLScheme]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CodepointTest.URLScheme]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TStringViewTest.DefaultConstructor]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=TStringViewTest.DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TStringViewTest.DefaultConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TStringViewTest.Constructor]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=TStringViewTest.Constructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TStringViewTest.Constructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TStringViewTest.RangeForLoop]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=TStringViewTest.RangeForLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TStringViewTest.RangeForLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLTest.DefaultConstructor]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLTest.DefaultConstructor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLTest.DefaultConstructor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLTest.Parse]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLTest.Parse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLTest.Parse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLTest.Build]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLTest.Build]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLTest.Build]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLTest.Resolve]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLTest.Resolve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLTest.Resolve]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLPathTest.Absolute]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLPathTest.Absolute]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLPathTest.Absolute]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLPathTest.DirectoryName]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLPathTest.DirectoryName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLPathTest.DirectoryName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLPathTest.BaseName]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLPathTest.BaseName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLPathTest.BaseName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLPathTest.Append]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLPathTest.Append]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLPathTest.Append]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[URLPathTest.Resolve]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=URLPathTest.Resolve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[URLPathTest.Resolve]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringIdTest.Builtin]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=StringIdTest.Builtin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringIdTest.Builtin]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringIdTest.Dynamic]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=StringIdTest.Dynamic]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringIdTest.Dynamic]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StringIdTest.Threads]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=StringIdTest.Threads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StringIdTest.Threads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadTest.RenderInParallel]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=ThreadTest.RenderInParallel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadTest.RenderInParallel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadTest.Scaling]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=ThreadTest.DISABLED_Scaling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadTest.Scaling]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[ThreadTest.Scaling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentBuilderTest.IncompleteEnd]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DocumentBuilderTest.IncompleteEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentBuilderTest.IncompleteEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentBuilderTest.Chunks]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DocumentBuilderTest.Chunks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentBuilderTest.Chunks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentTest.LayoutInvalidation]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DocumentTest.LayoutInvalidation]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentTest.LayoutInvalidation]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentTest.TextRuns]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DocumentTest.TextRuns]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentTest.TextRuns]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentTest.NestedTables]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DocumentTest.NestedTables]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentTest.NestedTables]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentTest.DrawCulling]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DocumentTest.DrawCulling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentTest.DrawCulling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentTest.HitTesting]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DocumentTest.HitTesting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentTest.HitTesting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DocumentTest.PaintOrder]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DocumentTest.PaintOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DocumentTest.PaintOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StylesheetCacheTest.HitsAndMedia]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=StylesheetCacheTest.HitsAndMedia]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StylesheetCacheTest.HitsAndMedia]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[StylesheetCacheTest.Eviction]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=StylesheetCacheTest.Eviction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[StylesheetCacheTest.Eviction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPoolTest.Reuse]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=ObjectPoolTest.Reuse]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPoolTest.Reuse]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ObjectPoolTest.Threads]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=ObjectPoolTest.Threads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ObjectPoolTest.Threads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DisplayListTest.ReplayMatchesDraw]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DisplayListTest.ReplayMatchesDraw]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DisplayListTest.ReplayMatchesDraw]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DisplayListTest.Culling]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=DisplayListTest.Culling]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DisplayListTest.Culling]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextWidthCacheTest.Hits]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=TextWidthCacheTest.Hits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextWidthCacheTest.Hits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextWidthCacheTest.Eviction]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=TextWidthCacheTest.Eviction]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextWidthCacheTest.Eviction]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TextWidthCacheTest.Batches]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=TextWidthCacheTest.Batches]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TextWidthCacheTest.Batches]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SplitTextTest.Spans]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=SplitTextTest.Spans]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SplitTextTest.Spans]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SplitTextTest.MatchesWcharSplit]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=SplitTextTest.MatchesWcharSplit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SplitTextTest.MatchesWcharSplit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SplitTextTest.Throughput]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=SplitTextTest.DISABLED_Throughput]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SplitTextTest.Throughput]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[SplitTextTest.Throughput]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FontCacheTest.Descriptor]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=FontCacheTest.Descriptor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FontCacheTest.Descriptor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FontCacheTest.SharedBetweenDocuments]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=FontCacheTest.SharedBetweenDocuments]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FontCacheTest.SharedBetweenDocuments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[FontCacheTest.UnusedFonts]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=FontCacheTest.UnusedFonts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FontCacheTest.UnusedFonts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"acid1.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/0]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"acid1.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"counter.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"counter.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"css-1-line-height.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"css-1-line-height.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"css-2-invalid-color.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/3]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"css-2-invalid-color.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"render-1-inline.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/4]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"render-1-inline.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"table-1-width.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/5]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"table-1-width.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"table-2-width.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/6]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"table-2-width.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"table-3-width.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/7]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"table-3-width.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"table-4-td-width.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/8]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"table-4-td-width.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test1.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/9]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test1.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test10.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/10]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test10.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test11.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/11]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test11.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test12.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/12]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test12.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test13.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/13]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test13.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test14.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/14]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test14.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test15.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/15]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test15.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test16.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/16]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test16.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test17.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/17]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test17.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test18.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/18]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test18.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test19.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/19]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test19.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test2.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/20]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test2.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test20.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/21]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test20.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test21.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/22]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test21.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test22.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/23]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test22.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test23.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/24]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test23.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test24.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/25]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test24.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test25.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/26]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test25.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test26.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/27]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test26.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test27.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/28]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test27.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test28.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/29]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test28.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test29.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/30]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test29.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test3.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/31]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test3.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test30.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/32]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test30.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test31.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/33]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test31.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test32.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/34]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test32.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test33.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/35]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test33.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test34.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/36]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test34.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test35.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/37]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test35.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test36.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/38]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test36.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test37.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/39]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test37.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test38.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/40]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test38.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test4.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/41]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test4.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test5.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/42]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test5.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test6.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/43]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test6.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test7.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/44]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test7.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test8.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/45]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test8.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"test9.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/46]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"test9.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"text-before-after.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/47]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"text-before-after.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[render_test._/"text-justify.htm"]=]  /root/repo/_rel_build/litehtml_tests [==[--gtest_filter=render_test._/48]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[render_test._/"text-justify.htm"]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_rel_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  litehtml_tests_TESTS CSSTest.Url CSSTest.LengthParse CSSTest.ElementSelectorParse CSSTest.SharedStylesheet MediaQueryTest.Check CodepointTest.URLReserved CodepointTest.URLScheme TStringViewTest.DefaultConstructor TStringViewTest.Constructor TStringViewTest.RangeForLoop URLTest.DefaultConstructor URLTest.Parse URLTest.Build URLTest.Resolve URLPathTest.Absolute URLPathTest.DirectoryName URLPathTest.BaseName URLPathTest.Append URLPathTest.Resolve StringIdTest.Builtin StringIdTest.Dynamic StringIdTest.Threads ThreadTest.RenderInParallel ThreadTest.Scaling DocumentBuilderTest.IncompleteEnd DocumentBuilderTest.Chunks DocumentTest.LayoutInvalidation DocumentTest.TextRuns DocumentTest.NestedTables DocumentTest.DrawCulling DocumentTest.HitTesting DocumentTest.PaintOrder StylesheetCacheTest.HitsAndMedia StylesheetCacheTest.Eviction ObjectPoolTest.Reuse ObjectPoolTest.Threads DisplayListTest.ReplayMatchesDraw DisplayListTest.Culling TextWidthCacheTest.Hits TextWidthCacheTest.Eviction TextWidthCacheTest.Batches SplitTextTest.Spans SplitTextTest.MatchesWcharSplit SplitTextTest.Throughput FontCacheTest.Descriptor FontCacheTest.SharedBetweenDocuments FontCacheTest.UnusedFonts [==[render_test._/"acid1.htm"]==] [==[render_test._/"counter.htm"]==] [==[render_test._/"css-1-line-height.htm"]==] [==[render_test._/"css-2-invalid-color.htm"]==] [==[render_test._/"render-1-inline.htm"]==] [==[render_test._/"table-1-width.htm"]==] [==[render_test._/"table-2-width.htm"]==] [==[render_test._/"table-3-width.htm"]==] [==[render_test._/"table-4-td-width.htm"]==] [==[render_test._/"test1.htm"]==] [==[render_test._/"test10.htm"]==] [==[render_test._/"test11.htm"]==] [==[render_test._/"test12.htm"]==] [==[render_test._/"test13.htm"]==] [==[render_test._/"test14.htm"]==] [==[render_test._/"test15.htm"]==] [==[render_test._/"test16.htm"]==] [==[render_test._/"test17.htm"]==] [==[render_test._/"test18.htm"]==] [==[render_test._/"test19.htm"]==] [==[render_test._/"test2.htm"]==] [==[render_test._/"test20.htm"]==] [==[render_test._/"test21.htm"]==] [==[render_test._/"test22.htm"]==] [==[render_test._/"test23.htm"]==] [==[render_test._/"test24.htm"]==] [==[render_test._/"test25.htm"]==] [==[render_test._/"test26.htm"]==] [==[render_test._/"test27.htm"]==] [==[render_test._/"test28.htm"]==] [==[render_test._/"test29.htm"]==] [==[render_test._/"test3.htm"]==] [==[render_test._/"test30.htm"]==] [==[render_test._/"test31.htm"]==] [==[render_test._/"test32.htm"]==] [==[render_test._/"test33.htm"]==] [==[render_test._/"test34.htm"]==] [==[render_test._/"test35.htm"]==] [==[render_test._/"test36.htm"]==] [==[render_test._/"test37.htm"]==] [==[render_test._/"test38.htm"]==] [==[render_test._/"test4.htm"]==] [==[render_test._/"test5.htm"]==] [==[render_test._/"test6.htm"]==] [==[render_test._/"test7.htm"]==] [==[render_test._/"test8.htm"]==] [==[render_test._/"test9.htm"]==] [==[render_test._/"text-before-after.htm"]==] [==[render_test._/"text-justify.htm"]==])
@@ -0,0 +1,52 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/litehtml_tests.dir/containers/test/Bitmap.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/containers/test/Bitmap.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/containers/test/Font.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/containers/test/Font.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/containers/test/lodepng.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/containers/test/lodepng.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/containers/test/test_container.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/containers/test/test_container.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/codepoint_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/codepoint_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/cssTest.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/cssTest.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/display_list_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/display_list_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/document_builder_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/document_builder_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/document_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/document_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/font_cache_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/font_cache_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/mediaQueryTest.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/mediaQueryTest.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/object_pool_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/object_pool_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/render_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/render_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/split_text_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/split_text_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/string_id_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/string_id_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/stylesheet_cache_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/stylesheet_cache_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/text_width_cache_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/text_width_cache_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/thread_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/thread_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/tstring_view_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/tstring_view_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/url_path_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/url_path_test.cpp.o.d"
+  "CMakeFiles/litehtml_tests.dir/test/url_test.cpp.o"
+  "CMakeFiles/litehtml_tests.dir/test/url_test.cpp.o.d"
+  "litehtml_tests"
+  "litehtml_tests.pdb"
+  "litehtml_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/litehtml_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/gumbo/attribute.c" "src/gumbo/CMakeFiles/gumbo.dir/attribute.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/attribute.c.o.d"
+  "/root/repo/src/gumbo/char_ref.c" "src/gumbo/CMakeFiles/gumbo.dir/char_ref.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/char_ref.c.o.d"
+  "/root/repo/src/gumbo/error.c" "src/gumbo/CMakeFiles/gumbo.dir/error.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/error.c.o.d"
+  "/root/repo/src/gumbo/parser.c" "src/gumbo/CMakeFiles/gumbo.dir/parser.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/parser.c.o.d"
+  "/root/repo/src/gumbo/string_buffer.c" "src/gumbo/CMakeFiles/gumbo.dir/string_buffer.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/string_buffer.c.o.d"
+  "/root/repo/src/gumbo/string_piece.c" "src/gumbo/CMakeFiles/gumbo.dir/string_piece.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/string_piece.c.o.d"
+  "/root/repo/src/gumbo/tag.c" "src/gumbo/CMakeFiles/gumbo.dir/tag.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/tag.c.o.d"
+  "/root/repo/src/gumbo/tokenizer.c" "src/gumbo/CMakeFiles/gumbo.dir/tokenizer.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/tokenizer.c.o.d"
+  "/root/repo/src/gumbo/utf8.c" "src/gumbo/CMakeFiles/gumbo.dir/utf8.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/utf8.c.o.d"
+  "/root/repo/src/gumbo/util.c" "src/gumbo/CMakeFiles/gumbo.dir/util.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/util.c.o.d"
+  "/root/repo/src/gumbo/vector.c" "src/gumbo/CMakeFiles/gumbo.dir/vector.c.o" "gcc" "src/gumbo/CMakeFiles/gumbo.dir/vector.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
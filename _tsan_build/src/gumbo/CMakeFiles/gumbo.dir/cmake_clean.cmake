@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gumbo.dir/attribute.c.o"
+  "CMakeFiles/gumbo.dir/attribute.c.o.d"
+  "CMakeFiles/gumbo.dir/char_ref.c.o"
+  "CMakeFiles/gumbo.dir/char_ref.c.o.d"
+  "CMakeFiles/gumbo.dir/error.c.o"
+  "CMakeFiles/gumbo.dir/error.c.o.d"
+  "CMakeFiles/gumbo.dir/parser.c.o"
+  "CMakeFiles/gumbo.dir/parser.c.o.d"
+  "CMakeFiles/gumbo.dir/string_buffer.c.o"
+  "CMakeFiles/gumbo.dir/string_buffer.c.o.d"
+  "CMakeFiles/gumbo.dir/string_piece.c.o"
+  "CMakeFiles/gumbo.dir/string_piece.c.o.d"
+  "CMakeFiles/gumbo.dir/tag.c.o"
+  "CMakeFiles/gumbo.dir/tag.c.o.d"
+  "CMakeFiles/gumbo.dir/tokenizer.c.o"
+  "CMakeFiles/gumbo.dir/tokenizer.c.o.d"
+  "CMakeFiles/gumbo.dir/utf8.c.o"
+  "CMakeFiles/gumbo.dir/utf8.c.o.d"
+  "CMakeFiles/gumbo.dir/util.c.o"
+  "CMakeFiles/gumbo.dir/util.c.o.d"
+  "CMakeFiles/gumbo.dir/vector.c.o"
+  "CMakeFiles/gumbo.dir/vector.c.o.d"
+  "libgumbo.a"
+  "libgumbo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/gumbo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -3,6 +3,8 @@
 
 #include <litehtml/html.h>
 #include <litehtml/document.h>
+#include <litehtml/document_builder.h>
+#include <litehtml/display_list.h>
 #include <litehtml/html_tag.h>
 #include <litehtml/stylesheet.h>
 #include <litehtml/element.h>
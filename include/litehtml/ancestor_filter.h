@@ -0,0 +1,84 @@
+#ifndef LH_ANCESTOR_FILTER_H
+#define LH_ANCESTOR_FILTER_H
+
+#include <cstring>
+#include "types.h"
+#include "string_id.h"
+
+namespace litehtml
+{
+	class css_selector;
+
+	// Counting Bloom filter of the tag, id and class names of the elements above the one being styled.
+	// It is filled during the apply_stylesheet/refresh_styles tree walk and lets most of the
+	// descendant/child selectors be rejected without climbing the parent chain.
+	class ancestor_filter
+	{
+	public:
+		static const int		max_selector_hashes = 4;
+	private:
+		static const unsigned	key_bits	= 12;
+		static const unsigned	key_mask	= (1u << key_bits) - 1;
+
+		unsigned char			m_counters[1u << key_bits];
+		int						m_depth;
+	public:
+		ancestor_filter() : m_depth(0)
+		{
+			memset(m_counters, 0, sizeof(m_counters));
+		}
+
+		int depth() const
+		{
+			return m_depth;
+		}
+
+		void push_element(string_id tag, string_id id, const std::vector<string_id>& classes);
+		void pop_element(string_id tag, string_id id, const std::vector<string_id>& classes);
+		bool may_match(const css_selector& selector) const;
+
+		static unsigned tag_hash(string_id name)	{ return hash(name, 1); }
+		static unsigned id_hash(string_id name)		{ return hash(name, 2); }
+		static unsigned class_hash(string_id name)	{ return hash(name, 3); }
+
+	private:
+		void add(unsigned hash);
+		void remove(unsigned hash);
+		bool may_contain(unsigned hash) const;
+		static unsigned hash(string_id name, unsigned salt);
+	};
+
+	inline unsigned ancestor_filter::hash(string_id name, unsigned salt)
+	{
+		unsigned h = ((unsigned) name << 2 | salt) * 0x9E3779B1u;
+		h ^= h >> 15;
+		h *= 0x85EBCA77u;
+		h ^= h >> 13;
+		// zero terminates the hash list of css_selector
+		return h ? h : 1;
+	}
+
+	inline void ancestor_filter::add(unsigned hash)
+	{
+		unsigned char& c1 = m_counters[hash & key_mask];
+		unsigned char& c2 = m_counters[(hash >> key_bits) & key_mask];
+		// saturated counters are never decremented, so the filter stays conservative
+		if(c1 != 0xFF) c1++;
+		if(c2 != 0xFF) c2++;
+	}
+
+	inline void ancestor_filter::remove(unsigned hash)
+	{
+		unsigned char& c1 = m_counters[hash & key_mask];
+		unsigned char& c2 = m_counters[(hash >> key_bits) & key_mask];
+		if(c1 != 0xFF) c1--;
+		if(c2 != 0xFF) c2--;
+	}
+
+	inline bool ancestor_filter::may_contain(unsigned hash) const
+	{
+		return m_counters[hash & key_mask] && m_counters[(hash >> key_bits) & key_mask];
+	}
+}
+
+#endif  // LH_ANCESTOR_FILTER_H
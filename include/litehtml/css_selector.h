@@ -3,6 +3,7 @@
 
 #include "style.h"
 #include "media_query.h"
+#include "ancestor_filter.h"
 
 namespace litehtml
 {
@@ -193,12 +194,15 @@ namespace litehtml
 		style::ptr				m_style;
 		int						m_order;
 		media_query_list::ptr	m_media_query;
+		// hashes of the names required on the ancestors, zero terminated if shorter
+		unsigned				m_ancestor_hashes[ancestor_filter::max_selector_hashes];
 	public:
 		explicit css_selector(const media_query_list::ptr& media = nullptr)
 		{
 			m_media_query	= media;
 			m_combinator	= combinator_descendant;
 			m_order			= 0;
+			memset(m_ancestor_hashes, 0, sizeof(m_ancestor_hashes));
 		}
 
 		~css_selector() = default;
@@ -217,10 +221,12 @@ namespace litehtml
 			m_specificity	= val.m_specificity;
 			m_order			= val.m_order;
 			m_media_query	= val.m_media_query;
+			memcpy(m_ancestor_hashes, val.m_ancestor_hashes, sizeof(m_ancestor_hashes));
 		}
 
 		bool parse(const string& text);
 		void calc_specificity();
+		void calc_ancestor_hashes();
 		bool is_media_valid() const;
 		void add_media_to_doc(document* doc) const;
 	};
@@ -0,0 +1,91 @@
+#ifndef LH_DISPLAY_LIST_H
+#define LH_DISPLAY_LIST_H
+
+#include <vector>
+#include <functional>
+#include "document_container.h"
+
+namespace litehtml
+{
+	class display_list_recorder;
+
+	// Flat list of the drawing operations of a document, recorded once after the layout with
+	// document::record() and replayed any number of times with different offsets and clips.
+	// The operations are culled by their bounds on replay, the operations inside of a clip that
+	// doesn't intersect the replay clip are skipped at once.
+	// The list must be recorded again after render() or any style change that requires redraw.
+	// Boxes with position: fixed are recorded at the client rect of the recording time.
+	// To serialize the list replay it into a container that writes the calls out.
+	class display_list
+	{
+		friend class display_list_recorder;
+	public:
+		enum op_type
+		{
+			op_text,
+			op_list_marker,
+			op_background,
+			op_borders,
+			op_set_clip,
+			op_del_clip
+		};
+
+		struct op
+		{
+			op_type		type;
+			int			data;	// index of the operation data in the storage of the operation type
+			int			end;	// op_set_clip: index of the matching op_del_clip or -1
+			position	bounds;	// the painted area without the replay offset
+		};
+
+	private:
+		struct text_data
+		{
+			size_t		text;	// offset of the null-terminated text in m_text
+			uint_ptr	font;
+			web_color	color;
+			position	pos;
+		};
+
+		struct marker_data
+		{
+			list_marker	marker;
+			string		baseurl;
+			bool		has_baseurl;
+		};
+
+		struct borders_data
+		{
+			borders		bdr;
+			position	pos;
+			bool		root;
+		};
+
+		struct clip_data
+		{
+			position		pos;
+			border_radiuses	radius;
+		};
+
+		std::vector<op>								m_ops;
+		string										m_text;
+		std::vector<text_data>						m_texts;
+		std::vector<marker_data>					m_markers;
+		std::vector<std::vector<background_paint>>	m_backgrounds;
+		std::vector<borders_data>					m_borders;
+		std::vector<clip_data>						m_clips;
+
+	public:
+		const std::vector<op>&	ops() const		{ return m_ops; }
+		bool					empty() const	{ return m_ops.empty(); }
+		void					clear();
+
+		// calls draw with a container that records the drawing calls into the list and forwards
+		// the other calls to container
+		void					record(document_container* container, const std::function<void(document_container*)>& draw);
+		// draws the list like document::draw() with the same arguments
+		void					replay(document_container* container, uint_ptr hdc, int x, int y, const position* clip) const;
+	};
+}
+
+#endif  // LH_DISPLAY_LIST_H
@@ -5,6 +5,9 @@
 #include "stylesheet.h"
 #include "types.h"
 #include "master_css.h"
+#include "style_sharing_cache.h"
+#include "text_width_cache.h"
+#include "font_cache.h"
 
 namespace litehtml
 {
@@ -44,8 +47,28 @@ namespace litehtml
         virtual void add_attr(const litehtml::string& name, const litehtml::string& value) = 0;
     };
 
+	// the statistics of the last document::draw() call
+	struct draw_statistics
+	{
+		int visited = 0;	// the render items drawn by draw_stacking_context()
+		int culled	= 0;	// the subtrees skipped because they are outside of the clip
+	};
+
+	// the time of the phases of the document loading in nanoseconds, see document::createFromString()
+	struct load_statistics
+	{
+		long long gumbo_parse			= 0;
+		long long create_elements		= 0;	// the elements from the gumbo tree
+		long long parse_attributes		= 0;	// including the style attributes
+		long long parse_stylesheets		= 0;	// the <style> and <link> stylesheets that are not in stylesheet_cache
+		long long apply_stylesheets		= 0;	// the master, document and user stylesheets
+		long long compute_styles		= 0;
+		long long create_render_tree	= 0;
+	};
+
 	class html_tag;
     class render_item;
+	class display_list;
 
 	class document : public std::enable_shared_from_this<document>
 	{
@@ -53,15 +76,24 @@ namespace litehtml
 		typedef std::shared_ptr<document>	ptr;
 		typedef std::weak_ptr<document>		weak_ptr;
 	private:
+		struct pending_text
+		{
+			const char*	text;
+			uint_ptr	font;
+			int*		width;
+		};
+
 		std::shared_ptr<element>			m_root;
 		std::shared_ptr<render_item>		m_root_render;
 		document_container*					m_container;
 		fonts_map							m_fonts;
+		bool								m_shared_fonts;	// every font of m_fonts is used once from font_cache
+		font_descriptor						m_font_lookup;	// reused to avoid the allocations of the long names
 		css_text::vector					m_css;
 		litehtml::css						m_styles;
 		litehtml::web_color					m_def_color;
-        litehtml::css						m_master_css;
-        litehtml::css						m_user_css;
+        css::const_ptr						m_master_css;
+        css::const_ptr						m_user_css;
 		litehtml::size						m_size;
 		litehtml::size						m_content_size;
 		position::vector					m_fixed_boxes;
@@ -71,14 +103,43 @@ namespace litehtml
 		media_features						m_media;
 		string								m_lang;
 		string								m_culture;
+		litehtml::ancestor_filter			m_ancestor_filter;
+		litehtml::style_sharing_cache		m_style_sharing_cache;
+		litehtml::text_width_cache			m_text_widths;
+		std::vector<pending_text>			m_pending_texts;	// the measure_text() calls of the current text batch
+		int									m_text_batches;		// the nesting level of begin_text_batch()
+		bool								m_layout_dirty;
+		litehtml::size						m_layout_size;	// max_width and client height of the last render
+		int									m_layout_result;
+		int									m_layout_generation;
+		litehtml::draw_statistics			m_draw_statistics;
+		litehtml::load_statistics			m_load_statistics;
+		int									m_ink_generation;	// the layout generation of the render items ink boxes
 	public:
 		document(document_container* objContainer);
 		virtual ~document();
 
 		document_container*				container()	{ return m_container; }
 		uint_ptr						get_font(const char* name, int size, const char* weight, const char* style, const char* decoration, font_metrics* fm);
+		uint_ptr						get_font(const char* name, int size, font_weight weight, font_style style, const char* decoration, font_metrics* fm);
+		// document_container::text_width() through the text width cache
+		int								text_width(const char* text, uint_ptr font);
+		// the measure_text() calls between begin_text_batch() and end_text_batch() are measured with one
+		// document_container::text_widths() call at the end of the outermost batch
+		void							begin_text_batch()	{ m_text_batches++; }
+		void							end_text_batch();
+		// stores text_width() into width, at the end of the text batch if there is one
+		void							measure_text(const char* text, uint_ptr font, int& width);
 		int								render(int max_width, render_type rt = render_all);
+		// renders the document only if the layout was invalidated or the size was changed since the last render
+		int								update_layout(int max_width);
+		void							invalidate_layout()	{ m_layout_dirty = true; }
+		bool							layout_dirty() const	{ return m_layout_dirty; }
+		// incremented by every render() call, the render items cache their layout for the current generation
+		int								layout_generation() const	{ return m_layout_generation; }
 		void							draw(uint_ptr hdc, int x, int y, const position* clip);
+		// records the drawing of the whole document into list, see display_list
+		void							record(display_list& list);
 		web_color						get_def_color()	{ return m_def_color; }
 		int								to_pixels(const char* str, int fontSize, bool* is_percent = nullptr) const;
 		void 							cvt_units(css_length& val, int fontSize, int size = 0) const;
@@ -88,6 +149,8 @@ namespace litehtml
 		int								content_width() const;
 		int								content_height() const;
 		void							add_stylesheet(const char* str, const char* baseurl, const char* media);
+		// returns the topmost element at the point, the render items ink boxes are used as a spatial index
+		element::ptr					get_element_by_point(int x, int y, int client_x, int client_y);
 		bool							on_mouse_over(int x, int y, int client_x, int client_y, position::vector& redraw_boxes);
 		bool							on_lbutton_down(int x, int y, int client_x, int client_y, position::vector& redraw_boxes);
 		bool							on_lbutton_up(int x, int y, int client_x, int client_y, position::vector& redraw_boxes);
@@ -102,18 +165,35 @@ namespace litehtml
 		bool							match_lang(const string& lang);
 		void							add_tabular(const std::shared_ptr<render_item>& el);
 		element::const_ptr				get_over_element() const { return m_over_element; }
+		ancestor_filter&				get_ancestor_filter() { return m_ancestor_filter; }
+		style_sharing_cache&			get_style_sharing_cache() { return m_style_sharing_cache; }
+		text_width_cache&				get_text_width_cache() { return m_text_widths; }
+		draw_statistics&				get_draw_statistics() { return m_draw_statistics; }
+		const load_statistics&			get_load_statistics() const { return m_load_statistics; }
 
 		void							append_children_from_string(element& parent, const char* str);
 		void							dump(dumper& cout);
 
 		static litehtml::document::ptr	createFromString(const char* str, litehtml::document_container* objPainter, const char* master_styles = litehtml::master_css, const char* user_styles = "");
+		// master_css and user_css are usually created once with css::create_shared and used for many documents
+		static litehtml::document::ptr	createFromString(const char* str, litehtml::document_container* objPainter, const css::const_ptr& master_css, const css::const_ptr& user_css = nullptr);
+		// litehtml::master_css parsed on the first call
+		static const css::const_ptr&	default_master_css();
 	
 	private:
-		uint_ptr	add_font(const char* name, int size, const char* weight, const char* style, const char* decoration, font_metrics* fm);
+		uint_ptr	get_font(const font_descriptor& descr, font_metrics* fm);
+
+		css::const_ptr parse_css(const char* str);
+		void parse_stylesheet(const css_text& text, const media_query_list::ptr& media);
+		void load_html(const char* str);
+
+		element::ptr create_element(const char* tag_name, string_map&& attributes);
+		element::ptr create_tag(const char* tag_name, const string_map& attributes);
 
-		void create_node(void* gnode, elements_list& elements, bool parseTextNode);
+		void create_node(void* gnode, std::vector<element::ptr>& elements, bool parseTextNode);
 		bool update_media_lists(const media_features& features);
 		void fix_tables_layout();
+		void update_ink_boxes();
 		void fix_table_children(const std::shared_ptr<render_item>& el_ptr, style_display disp, const char* disp_str);
 		void fix_table_parent(const std::shared_ptr<render_item> & el_ptr, style_display disp, const char* disp_str);
 	};
@@ -0,0 +1,47 @@
+#ifndef LH_DOCUMENT_BUILDER_H
+#define LH_DOCUMENT_BUILDER_H
+
+#include "document.h"
+
+namespace litehtml
+{
+	// Builds a document from HTML that arrives in chunks. The part received so far can be
+	// rendered and drawn before the rest of the data is available:
+	//
+	//   document_builder builder(&container);
+	//   while (read(chunk)) {
+	//       builder.append(chunk.data(), chunk.size());
+	//       if (auto doc = builder.get_document()) { doc->render(width); doc->draw(...); }
+	//   }
+	//   builder.finish();
+	//   auto doc = builder.get_document();
+	class document_builder
+	{
+		document_container*	m_container;
+		string				m_master_styles;
+		string				m_user_styles;
+		string				m_html;
+		size_t				m_parsed_length;	// length of the html the current document is built from
+		document::ptr		m_document;
+		bool				m_finished;
+	public:
+		explicit document_builder(document_container* container, const char* master_styles = litehtml::master_css, const char* user_styles = "");
+
+		// adds the next chunk of html, the chunks don't have to end on tag or character boundaries
+		void			append(const char* data, size_t length);
+		// no more data will come, the unfinished tag or character at the end is parsed as is
+		void			finish();
+		bool			finished() const	{ return m_finished; }
+		// returns true if get_document() would build a new document
+		bool			has_changes() const;
+		// Returns the document built from the data received so far. A new document is built
+		// only if has_changes() is true, otherwise the previous one is returned. The previous
+		// documents stay valid while they are referenced.
+		document::ptr	get_document();
+
+	private:
+		size_t			complete_length() const;
+	};
+}
+
+#endif  // LH_DOCUMENT_BUILDER_H
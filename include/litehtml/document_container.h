@@ -7,6 +7,7 @@
 #include "background.h"
 #include "borders.h"
 #include "element.h"
+#include "tstring_view.h"
 #include <memory>
 #include <functional>
 
@@ -23,6 +24,14 @@ namespace litehtml
 		uint_ptr		font;
 	};
 
+	// the text to measure with document_container::text_widths(), width is filled by the container
+	struct text_measurement
+	{
+		const char*		text;
+		uint_ptr		font;
+		int				width;
+	};
+
 	// call back interface to draw text, images and other elements
 	class document_container
 	{
@@ -30,6 +39,8 @@ namespace litehtml
 		virtual litehtml::uint_ptr	create_font(const char* faceName, int size, int weight, litehtml::font_style italic, unsigned int decoration, litehtml::font_metrics* fm) = 0;
 		virtual void				delete_font(litehtml::uint_ptr hFont) = 0;
 		virtual int					text_width(const char* text, litehtml::uint_ptr hFont) = 0;
+		// measures all items at once, the texts are unique for every font. Calls text_width() for every item by default.
+		virtual void				text_widths(std::vector<litehtml::text_measurement>& items);
 		virtual void				draw_text(litehtml::uint_ptr hdc, const char* text, litehtml::uint_ptr hFont, litehtml::web_color color, const litehtml::position& pos) = 0;
 		virtual int					pt_to_px(int pt) const = 0;
 		virtual int					get_default_font_size() const = 0;
@@ -61,7 +72,9 @@ namespace litehtml
 		virtual void				get_media_features(litehtml::media_features& media) const = 0;
 		virtual void				get_language(litehtml::string& language, litehtml::string& culture) const = 0;
 		virtual litehtml::string	resolve_color(const litehtml::string& /*color*/) const { return litehtml::string(); }
-		virtual void				split_text(const char* text, const std::function<void(const char*)>& on_word, const std::function<void(const char*)>& on_space);
+		// calls on_word and on_space for the words and the white space characters of the UTF-8 text,
+		// the spans point into text. Every CJK ideograph is a separate word.
+		virtual void				split_text(const char* text, const std::function<void(litehtml::tstring_view)>& on_word, const std::function<void(litehtml::tstring_view)>& on_space);
 
 	protected:
 		~document_container() = default;
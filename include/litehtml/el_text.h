@@ -2,29 +2,55 @@
 #define LH_EL_TEXT_H
 
 #include "html_tag.h"
+#include "tstring_view.h"
 
 namespace litehtml
 {
+	/**
+	 * A run of text: all words and spaces of a text node are stored in one element. The run is split into
+	 * segments at the break opportunities found by document_container::split_text(), every segment is a
+	 * word, a white space character or a CJK ideograph. The segments are placed into the line boxes one
+	 * by one, see render_item_text.
+	 */
 	class el_text : public element
 	{
 	protected:
-		string			m_text;
-		string			m_transformed_text;
-		size			m_size;
-		bool			m_use_transformed;
-		bool			m_draw_spaces;
+		struct segment
+		{
+			int		offset;			// the segment text in m_text, it is followed by '\0'
+			int		transformed;	// the offset of the transformed text in m_transformed_text or -1
+			int		width;
+			bool	space;
+		};
+
+		string					m_text;				// the segments separated by '\0'
+		string					m_transformed_text;
+		std::vector<segment>	m_segments;
+		int						m_height;			// the height of the segments, 0 without a font
+		bool					m_draw_spaces;
 	public:
 		el_text(const char* text, const document::ptr& doc);
+		el_text(tstring_view text, const document::ptr& doc);
+
+		// appends the next segment of the run
+		void				add_segment(tstring_view text, bool space);
+		int					segments_count() const				{ return (int) m_segments.size(); }
+		// the text to draw: transformed, spaces collapsed
+		const char*			segment_text(int index) const;
+		int					segment_width(int index) const		{ return m_segments[index].width; }
+		int					segment_height(int index) const		{ return is_segment_break(index) ? 0 : m_height; }
+		bool				is_segment_space(int index) const	{ return m_segments[index].space; }
+		bool				is_segment_white_space(int index) const;
+		bool				is_segment_break(int index) const;
 
 		void				get_text(string& text) override;
 		void				compute_styles(bool recursive) override;
         bool				is_text() const override { return true; }
 
         void draw(uint_ptr hdc, int x, int y, const position *clip, const std::shared_ptr<render_item> &ri) override;
+        std::shared_ptr<render_item> create_render_item(const std::shared_ptr<render_item>& parent_ri) override;
         string             dump_get_name() override;
         std::vector<std::tuple<string, string>> dump_get_attrs() override;
-	protected:
-		void				get_content_size(size& sz, int max_width) override;
 	};
 }
 
@@ -81,9 +81,11 @@ namespace litehtml
 		virtual void				set_data(const char* data);
 
 		virtual void				set_attr(const char* name, const char* val);
+		virtual void				set_attr(string_id name, string&& val);
 		virtual const char*			get_attr(const char* name, const char* def = nullptr) const;
 		virtual void				apply_stylesheet(const litehtml::css& stylesheet);
 		virtual void				refresh_styles();
+		virtual void				update_ancestor_filter(ancestor_filter& filter, bool add) const;
 		virtual bool				is_white_space() const;
 		virtual bool				is_space() const;
 		virtual bool				is_comment() const;
@@ -136,6 +138,7 @@ namespace litehtml
 		std::tuple<element::ptr, element::ptr, element::ptr> split_inlines();
 		virtual std::shared_ptr<render_item> create_render_item(const std::shared_ptr<render_item>& parent_ri);
 		bool requires_styles_update();
+		style_change get_style_change();
 		void add_render(const std::shared_ptr<render_item>& ri);
 		bool find_styles_changes( position::vector& redraw_boxes);
 		element::ptr add_pseudo_before(const style& style)
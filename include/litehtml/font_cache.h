@@ -0,0 +1,131 @@
+#ifndef LH_FONT_CACHE_H
+#define LH_FONT_CACHE_H
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include "types.h"
+
+#ifndef LITEHTML_NO_THREADS
+	#include <condition_variable>
+	#include <mutex>
+#endif
+
+namespace litehtml
+{
+	class document_container;
+
+	// the parameters of document_container::create_font()
+	struct font_descriptor
+	{
+		string			name;
+		int				size		= 0;
+		int				weight		= 400;
+		font_style		style		= font_style_normal;
+		unsigned int	decoration	= font_decoration_none;
+
+		bool operator==(const font_descriptor& val) const
+		{
+			return size == val.size && weight == val.weight && style == val.style && decoration == val.decoration && name == val.name;
+		}
+
+		// numeric weight of the font-weight keyword, bolder and lighter are relative to normal
+		static int			get_weight(font_weight weight);
+		// font_decoration_* flags of the text-decoration value
+		static unsigned int	get_decoration(const char* decoration);
+	};
+
+	struct font_descriptor_hash
+	{
+		size_t operator()(const font_descriptor& descr) const;
+	};
+
+	typedef std::unordered_map<font_descriptor, font_item, font_descriptor_hash> fonts_map;
+
+	// Process-wide cache of the fonts created by the document containers. The sharing is disabled by
+	// default and every document creates and deletes its own fonts. After set_enabled(true) the new
+	// documents of the same container share its fonts, a font is deleted with
+	// document_container::delete_font() when no document uses it. That can happen on the thread of
+	// another document of the container, so its create_font() and delete_font() must be thread safe.
+	// They are called without holding the lock of the cache.
+	// Up to max_unused() fonts that no document uses are kept for the next documents, the least
+	// recently used are deleted first. No unused fonts are kept by default; if max_unused() is not 0,
+	// clear(container) must be called before the container is destroyed.
+	class font_cache
+	{
+	public:
+		struct statistics
+		{
+			int		hits		= 0;
+			int		misses		= 0;
+			int		evictions	= 0;
+			int		entries		= 0;
+			int		unused		= 0;	// the entries that no document uses
+		};
+
+		static const size_t default_max_unused = 0;
+
+	private:
+		struct key
+		{
+			document_container*	container;
+			font_descriptor		descr;
+
+			bool operator==(const key& val) const
+			{
+				return container == val.container && descr == val.descr;
+			}
+		};
+
+		struct key_hash
+		{
+			size_t operator()(const key& k) const;
+		};
+
+		struct entry
+		{
+			font_item							item;
+			int									refs;
+			bool								created;	// false while the first get() creates the font
+			std::list<const key*>::iterator		unused;
+		};
+
+		// the fonts removed from the cache, deleted after unlocking
+		typedef std::vector<std::pair<document_container*, uint_ptr>> deleted_fonts;
+
+		std::unordered_map<key, entry, key_hash>	m_fonts;
+		std::list<const key*>						m_unused;	// the keys of the unused fonts, most recently used first
+		size_t										m_max_unused;
+		bool										m_enabled;
+		statistics									m_stats;
+#ifndef LITEHTML_NO_THREADS
+		mutable std::mutex							m_mutex;
+		std::condition_variable						m_created;
+#endif
+	public:
+		font_cache() : m_max_unused(default_max_unused), m_enabled(false) {}
+
+		static font_cache& instance();
+
+		// the documents use the cache if it was enabled when they were created
+		bool			enabled() const;
+		void			set_enabled(bool enabled);
+
+		// returns the cached font or creates it, every get() must be paired with release()
+		font_item		get(document_container* container, const font_descriptor& descr);
+		void			release(document_container* container, const font_descriptor& descr);
+		// deletes the unused fonts of the container
+		void			clear(document_container* container);
+
+		size_t			max_unused() const;
+		void			set_max_unused(size_t max_unused);
+		statistics		get_statistics() const;
+
+	private:
+		void			evict(size_t max_unused, deleted_fonts& deleted);
+		void			update_statistics();
+		static void		delete_fonts(const deleted_fonts& deleted);
+	};
+}
+
+#endif  // LH_FONT_CACHE_H
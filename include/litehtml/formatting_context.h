@@ -2,6 +2,8 @@
 #define LITEHTML_FLOATS_HOLDER_H
 
 #include <list>
+#include <map>
+#include <climits>
 #include "types.h"
 
 namespace litehtml
@@ -9,15 +11,69 @@ namespace litehtml
 	class formatting_context
 	{
 	private:
+		// Step function of y: the value of the interval [key, next key) is stored at the key.
+		// Each float adds its top and bottom as keys and changes the values of [top, bottom).
+		template<class T> class float_steps
+		{
+		public:
+			typedef std::map<int, T> steps_map;
+		private:
+			steps_map	m_steps;
+			T			m_default;
+		public:
+			explicit float_steps(const T& def) : m_default(def) {}
+
+			const T& get(int y) const
+			{
+				auto iter = m_steps.upper_bound(y);
+				if(iter == m_steps.begin())
+				{
+					return m_default;
+				}
+				return (--iter)->second;
+			}
+			template<class F> void update(int top, int bottom, F func)
+			{
+				auto end = m_steps.emplace(bottom, get(bottom)).first;
+				auto iter = m_steps.emplace(top, get(top)).first;
+				if(top < bottom)
+				{
+					for(; iter != end; iter++)
+					{
+						func(iter->second);
+					}
+				}
+			}
+			const steps_map& steps() const
+			{
+				return m_steps;
+			}
+			void clear()
+			{
+				m_steps.clear();
+			}
+		};
+
+		struct line_bounds
+		{
+			int left;		// the right edge of the left floats
+			int right;		// the left edge of the right floats
+		};
+
 		std::list<floated_box> m_floats_left;
 		std::list<floated_box> m_floats_right;
-		int_int_cache m_cache_line_left;
-		int_int_cache m_cache_line_right;
+		float_steps<line_bounds> m_lines;				// the keys are the tops and bottoms of all floats
+		std::map<int, float_steps<int>> m_min_left;		// the sum of the left floats min widths by context
+		std::map<int, float_steps<int>> m_min_right;	// the sum of the right floats min widths by context
+		int m_left_bottom;
+		int m_right_bottom;
+		int m_clear_left_top;						// the top of the lowest float with clear: left/both
+		int m_clear_right_top;						// the top of the lowest float with clear: right/both
 		int m_current_top;
 		int m_current_left;
 
 	public:
-		formatting_context() : m_current_top(0), m_current_left(0)	{}
+		formatting_context() : m_lines({0, INT_MAX}), m_left_bottom(0), m_right_bottom(0), m_clear_left_top(0), m_clear_right_top(0), m_current_top(0), m_current_left(0)	{}
 
 		void push_position(int x, int y)
 		{
@@ -48,6 +104,10 @@ namespace litehtml
 		void apply_relative_shift(const containing_block_context &containing_block_size);
 		int find_min_left(int y, int context_idx);
 		int find_min_right(int y, int right, int context_idx);
+
+	private:
+		void index_float(const floated_box& fb);
+		void reindex_floats();
 	};
 }
 
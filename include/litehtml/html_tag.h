@@ -22,13 +22,15 @@ namespace litehtml
 		friend class line_box;
 	public:
 		typedef std::shared_ptr<html_tag>	ptr;
+		// sorted by the attribute name
+		typedef std::vector<std::pair<string_id, string>>	attr_map;
 	protected:
 		string_id				m_tag;
 		string_id				m_id;
 		string_vector			m_str_classes;
 		std::vector<string_id>	m_classes;
 		litehtml::style			m_style;
-		string_map				m_attrs;
+		attr_map				m_attrs;
 		std::vector<string_id>	m_pseudo_classes;
 
 		void			select_all(const css_selector& selector, elements_list& res) override;
@@ -48,9 +50,12 @@ namespace litehtml
 		void				set_data(const char* data) override;
 
 		void				set_attr(const char* name, const char* val) override;
+		void				set_attr(string_id name, string&& val) override;
 		const char*			get_attr(const char* name, const char* def = nullptr) const override;
+		const char*			get_attr(string_id name, const char* def = nullptr) const;
 		void				apply_stylesheet(const litehtml::css& stylesheet) override;
 		void				refresh_styles() override;
+		void				update_ancestor_filter(ancestor_filter& filter, bool add) const override;
 
 		bool				is_white_space() const override;
 		bool				is_body() const override;
@@ -65,6 +70,7 @@ namespace litehtml
 		bool				set_class(const char* pclass, bool add) override;
 		bool				is_replaced() const override;
 		void				compute_styles(bool recursive = true) override;
+		bool				can_share_style(const html_tag& sibling) const;
 		void				draw(uint_ptr hdc, int x, int y, const position *clip, const std::shared_ptr<render_item> &ri) override;
 		void				draw_background(uint_ptr hdc, int x, int y, const position *clip,
 									const std::shared_ptr<render_item> &ri) override;
@@ -122,6 +128,7 @@ namespace litehtml
 
 	private:
 		void				handle_counter_properties();
+		bool				seed_ancestor_filter(ancestor_filter& filter, bool add) const;
 
 	};
 
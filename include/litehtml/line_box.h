@@ -5,6 +5,7 @@
 #include <memory>
 #include "os_types.h"
 #include "types.h"
+#include "object_pool.h"
 
 namespace litehtml
 {
@@ -37,6 +38,7 @@ namespace litehtml
 			type_inline_continue,
 			type_inline_end
 		};
+		typedef std::vector<std::unique_ptr<line_box_item>> vector;
 	protected:
 		std::shared_ptr<render_item> m_element;
 		int m_rendered_min_width;
@@ -45,21 +47,54 @@ namespace litehtml
 		line_box_item() = default;
 		line_box_item(const line_box_item& el) = default;
 		line_box_item(line_box_item&&) = default;
+		virtual ~line_box_item() = default;
+
+		static void* operator new(size_t size)				{ return object_pool::allocate(size); }
+		static void operator delete(void* ptr, size_t size)	{ object_pool::deallocate(ptr, size); }
 
-		int height() const { return right() - left(); }
 		const std::shared_ptr<render_item>& get_el() const { return m_element; }
 		virtual position& pos();
 		virtual void place_to(int x, int y);
 		virtual int width() const;
+		virtual int height() const;
 		virtual int top() const;
 		virtual int bottom() const;
 		virtual int right() const;
 		virtual int left() const;
+		virtual bool is_white_space() const;
+		virtual bool is_break() const;
+		virtual bool is_space() const;
+		virtual bool skip() const;
+		virtual void skip(bool val);
+		virtual void apply_relative_shift(const containing_block_context &containing_block_size);
 		virtual element_type get_type() const	{ return type_text_part; }
 		virtual int get_rendered_min_width() const	{ return m_rendered_min_width; }
 		virtual void set_rendered_min_width(int min_width)	{ m_rendered_min_width = min_width; }
 	};
 
+	// a segment of a text run, the box is stored in the render_item_text
+	class lbi_text : public line_box_item
+	{
+		int m_index;
+	public:
+		lbi_text(const std::shared_ptr<render_item>& element, int index);
+
+		position& pos() override;
+		void place_to(int x, int y) override;
+		int width() const override;
+		int height() const override;
+		int top() const override;
+		int bottom() const override;
+		int right() const override;
+		int left() const override;
+		bool is_white_space() const override;
+		bool is_break() const override;
+		bool is_space() const override;
+		bool skip() const override;
+		void skip(bool val) override;
+		void apply_relative_shift(const containing_block_context &containing_block_size) override;
+	};
+
 	class lbi_start : public line_box_item
 	{
 	protected:
@@ -122,7 +157,7 @@ namespace litehtml
         int						m_baseline;
         text_align				m_text_align;
 		int 					m_min_width;
-		std::list< std::unique_ptr<line_box_item> > m_items;
+		line_box_item::vector	m_items;
     public:
         line_box(int top, int left, int right, int line_height, const font_metrics& fm, text_align align) :
 				m_top(top),
@@ -139,6 +174,9 @@ namespace litehtml
 		{
         }
 
+		static void* operator new(size_t size)				{ return object_pool::allocate(size); }
+		static void operator delete(void* ptr, size_t size)	{ object_pool::deallocate(ptr, size); }
+
         int		bottom() const	{ return m_top + height();	}
         int		top() const		{ return m_top;				}
         int		right() const	{ return m_left + width();	}
@@ -155,11 +193,11 @@ namespace litehtml
         int					top_margin() const;
         int					bottom_margin() const;
         void				y_shift(int shift);
-		std::list< std::unique_ptr<line_box_item> >	finish(bool last_box, const containing_block_context &containing_block_size);
-		std::list< std::unique_ptr<line_box_item> > new_width(int left, int right);
-		std::shared_ptr<render_item> 		get_last_text_part() const;
-		std::shared_ptr<render_item> 		get_first_text_part() const;
-		std::list< std::unique_ptr<line_box_item> >& 	items() { return m_items; }
+		line_box_item::vector	finish(bool last_box, const containing_block_context &containing_block_size);
+		line_box_item::vector	new_width(int left, int right);
+		const line_box_item* 		get_last_text_part() const;
+		const line_box_item* 		get_first_text_part() const;
+		line_box_item::vector& 			items() { return m_items; }
 	private:
         bool				have_last_space() const;
         bool				is_break_only() const;
@@ -0,0 +1,25 @@
+#ifndef LH_OBJECT_POOL_H
+#define LH_OBJECT_POOL_H
+
+#include <cstddef>
+
+namespace litehtml
+{
+	// Recycles the memory of the small objects that every layout creates and destroys in large numbers
+	// (the line boxes and their items). The freed blocks are kept in per-thread free lists by size and
+	// reused by the next allocation of the same size. Objects larger than max_object_size go to the
+	// global operator new.
+	// Usage: declare operator new/delete in the class and forward them to allocate()/deallocate().
+	// The class hierarchy must have a virtual destructor, deallocate() needs the size of the object.
+	class object_pool
+	{
+	public:
+		static const size_t granularity		= 16;
+		static const size_t max_object_size	= 256;
+
+		static void*	allocate(size_t size);
+		static void		deallocate(void* ptr, size_t size);
+	};
+}
+
+#endif  // LH_OBJECT_POOL_H
@@ -2,6 +2,7 @@
 #define LITEHTML_RENDER_INLINE_CONTEXT_H
 
 #include "render_block.h"
+#include "render_text.h"
 
 namespace litehtml
 {
@@ -29,16 +30,18 @@ namespace litehtml
 		};
 	protected:
 		std::vector<std::unique_ptr<litehtml::line_box> > m_line_boxes;
+		std::vector<std::shared_ptr<render_item_text> > m_text_runs;
 		int m_max_line_width;
 
 		int _render_content(int x, int y, bool second_pass, const containing_block_context &self_size, formatting_context* fmt_ctx) override;
 		void fix_line_width(element_float flt,
 							const containing_block_context &self_size, formatting_context* fmt_ctx) override;
 
-		std::list<std::unique_ptr<line_box_item> > finish_last_box(bool end_of_render, const containing_block_context &self_size);
+		line_box_item::vector finish_last_box(bool end_of_render, const containing_block_context &self_size);
 		void place_inline(std::unique_ptr<line_box_item> item, const containing_block_context &self_size, formatting_context* fmt_ctx);
 		int new_box(const std::unique_ptr<line_box_item>& el, line_context& line_ctx, const containing_block_context &self_size, formatting_context* fmt_ctx);
 		void apply_vertical_align() override;
+		void update_text_runs();
 	public:
 		explicit render_item_inline_context(std::shared_ptr<element>  src_el) : render_item_block(std::move(src_el)), m_max_line_width(0)
 		{}
@@ -16,10 +16,40 @@ namespace litehtml
 
     class render_item : public std::enable_shared_from_this<render_item>
     {
+    public:
+		// An operation of the flat drawing list of a stacking context, see draw_stacking_context().
+		// The positions are relative to the position the stacking context is drawn at.
+		struct paint_op
+		{
+			enum op_type
+			{
+				op_group,				// el with its subtree up to the op at index, skipped if culled
+				op_cull,				// the same as op_group without the visibility check
+				op_draw,
+				op_draw_background,
+				op_stacking_context,
+				op_set_clip,			// the overflow clip of el with its content box at x, y
+				op_del_clip
+			};
+			op_type							type;
+			std::shared_ptr<render_item>	el;
+			int								x;
+			int								y;
+			int								index;
+			bool							fixed;				// drawn at the client rect position
+			bool							with_positioned;	// op_stacking_context
+		};
+		struct paint_list
+		{
+			std::vector<paint_op>	ops;
+			int						generation = -1;	// the layout generation of the list
+			bool					with_positioned = false;
+		};
+
     protected:
         std::shared_ptr<element>                    m_element;
         std::weak_ptr<render_item>                  m_parent;
-        std::list<std::shared_ptr<render_item>>     m_children;
+        std::vector<std::shared_ptr<render_item>>   m_children;
         margins						                m_margins;
         margins						                m_padding;
         margins						                m_borders;
@@ -27,6 +57,47 @@ namespace litehtml
         bool                                        m_skip;
         std::vector<std::shared_ptr<render_item>>   m_positioned;
 
+		// The constraints and the result of the last layout of an independent subtree (a block formatting
+		// context or a table). Valid during one document::render() call only.
+		struct layout_cache
+		{
+			int							generation = -1;
+			containing_block_context	cb_context;
+			bool						second_pass = false;	// the layout can be reused by the second pass renders only
+			int							result = 0;
+			position					pos;		// m_pos relative to the x, y arguments of render()
+			margins						box_margins;	// the collapsed margins
+		};
+		layout_cache								m_layout_cache;
+		// The widths returned by measure() during the current layout generation
+		int											m_measured_generation = -1;
+		std::vector<std::pair<containing_block_context, int>>	m_measured_widths;
+		// The area drawn by the item and its descendants in the coordinates of m_pos, see update_ink_box()
+		position									m_ink_box;
+		// The children of long lists bucketed by the vertical intervals of their ink boxes, lets
+		// get_child_by_point() skip the children that can't contain the point. Built by update_ink_box().
+		struct child_index
+		{
+			int								top = 0;
+			int								step = 0;	// the height of a bucket, 0 if there is no index
+			std::vector<std::vector<int>>	buckets;	// the indexes in m_children in increasing order
+
+			const std::vector<int>* find(int y) const;
+		};
+		child_index									m_child_index;
+
+		void build_child_index();
+
+		// The drawing order of the stacking context, built by the first draw after the layout
+		paint_list									m_paint;
+
+		void build_paint_list(bool with_positioned);
+		static void add_paint_op(paint_list& list, paint_op::op_type type, const std::shared_ptr<render_item>& el, int x, int y, bool with_positioned = false);
+		// closes the group or removes it if nothing was added after the group op at index
+		static void end_paint_group(paint_list& list, size_t index);
+		// the radius of the overflow clip, not stored in the paint list because it changes without a relayout
+		border_radiuses get_clip_radius() const;
+
 		containing_block_context calculate_containing_block_context(const containing_block_context& cb_context);
 		void calc_cb_length(const css_length& len, int percent_base, containing_block_context::typed_int& out_value) const;
 		virtual int _render(int x, int y, const containing_block_context& containing_block_size, formatting_context* fmt_ctx, bool second_pass = false)
@@ -39,7 +110,7 @@ namespace litehtml
 
         virtual ~render_item() = default;
 
-        std::list<std::shared_ptr<render_item>>& children()
+        std::vector<std::shared_ptr<render_item>>& children()
         {
             return m_children;
         }
@@ -304,9 +375,27 @@ namespace litehtml
         }
 
 		int render(int x, int y, const containing_block_context& containing_block_size, formatting_context* fmt_ctx, bool second_pass = false);
+		// Intrinsic widths of a block formatting context: the width of the content laid out with no space
+		// for the content and with all the available space. The subtree is left in an intermediate state,
+		// it must be rendered again before drawing.
+		int min_content_width(const containing_block_context& containing_block_size)
+		{
+			return measure(containing_block_size.new_width(content_offset_width()));
+		}
+		int max_content_width(const containing_block_context& containing_block_size)
+		{
+			return measure(containing_block_size);
+		}
+		int measure(const containing_block_context& containing_block_size);
+		// the next render() call will lay out the subtree even if the constraints are not changed
+		void invalidate_layout_cache()
+		{
+			m_layout_cache.generation = -1;
+		}
         int calc_width(int defVal, int containing_block_width) const;
         bool get_predefined_height(int& p_height, int containing_block_height) const;
         void apply_relative_shift(const containing_block_context &containing_block_size);
+        void apply_relative_shift(const containing_block_context &containing_block_size, position& pos) const;
         void calc_outlines( int parent_width );
         int calc_auto_margins(int parent_width);	// returns left margin
 
@@ -327,12 +416,28 @@ namespace litehtml
         void add_positioned(const std::shared_ptr<litehtml::render_item> &el);
         void get_redraw_box(litehtml::position& pos, int x = 0, int y = 0);
         void calc_document_size( litehtml::size& sz, litehtml::size& content_size, int x = 0, int y = 0 );
+		// Calculates the ink boxes of the subtree after the layout. Unbounded until the first call.
+		virtual void update_ink_box();
+		const position& ink_box() const
+		{
+			return m_ink_box;
+		}
+		// x, y: the position the item is drawn at (the content position of the parent)
+		bool is_ink_visible(int x, int y, const position* clip) const
+		{
+			if(!clip) return true;
+			position box = m_ink_box;
+			box.x += x;
+			box.y += y;
+			return box.does_intersect(clip);
+		}
 		virtual void get_inline_boxes( position::vector& boxes ) const {};
 		virtual void set_inline_boxes( position::vector& boxes ) {};
 		virtual void add_inline_box( const position& box ) {};
 		virtual void clear_inline_boxes() {};
         void draw_stacking_context( uint_ptr hdc, int x, int y, const position* clip, bool with_positioned );
-        virtual void draw_children( uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex );
+		// Adds the ops of the draw pass for the children, x, y: the position the item is drawn at
+		virtual void add_paint_ops(paint_list& list, int x, int y, draw_flag flag, int zindex);
         virtual int get_draw_vertical_offset() { return 0; }
         virtual std::shared_ptr<element> get_child_by_point(int x, int y, int client_x, int client_y, draw_flag flag, int zindex);
         std::shared_ptr<element> get_element_by_point(int x, int y, int client_x, int client_y);
@@ -22,7 +22,8 @@ namespace litehtml
 		{
 			return std::make_shared<render_item_table>(src_el());
 		}
-		void draw_children(uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex) override;
+		void add_paint_ops(paint_list& list, int x, int y, draw_flag flag, int zindex) override;
+		void update_ink_box() override;
 		int get_draw_vertical_offset() override;
 		std::shared_ptr<render_item> init() override;
 	};
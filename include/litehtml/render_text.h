@@ -0,0 +1,76 @@
+#ifndef LITEHTML_RENDER_TEXT_H
+#define LITEHTML_RENDER_TEXT_H
+
+#include "render_item.h"
+#include "el_text.h"
+
+namespace litehtml
+{
+	/**
+	 * The render item of a text run. Every segment of the run is placed into the line boxes separately
+	 * (see lbi_text), its box is stored here in the coordinates of m_pos. After the layout m_pos is the
+	 * bounding box of the placed segments.
+	 */
+	class render_item_text : public render_item
+	{
+		struct segment_box
+		{
+			position	pos;
+			bool		skip;
+		};
+		std::vector<segment_box> m_boxes;
+
+	public:
+		explicit render_item_text(std::shared_ptr<element>  src_el) : render_item(std::move(src_el))
+		{}
+
+		std::shared_ptr<render_item> clone() override
+		{
+			return std::make_shared<render_item_text>(src_el());
+		}
+
+		const el_text& text() const { return static_cast<const el_text&>(*src_el()); }
+
+		int			boxes_count() const					{ return (int) m_boxes.size(); }
+		position&	box(int index)						{ return m_boxes[index].pos; }
+		bool		is_box_skipped(int index) const		{ return m_boxes[index].skip; }
+		void		skip_box(int index, bool val)		{ m_boxes[index].skip = val; }
+
+		// sets the sizes of the segments, no segment is placed yet
+		void reset_boxes()
+		{
+			const el_text& txt = text();
+			m_boxes.resize(txt.segments_count());
+			for(int i = 0; i < (int) m_boxes.size(); i++)
+			{
+				m_boxes[i].pos = position(0, 0, txt.segment_width(i), txt.segment_height(i));
+				m_boxes[i].skip = true;
+			}
+		}
+
+		// m_pos becomes the bounding box of the placed segments, the run is skipped if none is placed
+		void update_pos()
+		{
+			bool placed = false;
+			for(const auto& seg : m_boxes)
+			{
+				if(seg.skip) continue;
+				if(!placed)
+				{
+					m_pos = seg.pos;
+					placed = true;
+				} else
+				{
+					m_pos.unite(seg.pos);
+				}
+			}
+			if(!placed)
+			{
+				m_pos = position();
+			}
+			skip(!placed);
+		}
+	};
+}
+
+#endif //LITEHTML_RENDER_TEXT_H
@@ -137,6 +137,28 @@ STRING_ID(
 	__tag_before_, // note: real tag cannot start with '-'
 	__tag_after_,
 
+	// HTML attributes
+	_id_,
+	_class_,
+	_href_,
+	_src_,
+	_alt_,
+	_rel_,
+	_media_,
+	_type_,
+	_name_,
+	_value_,
+	_align_,
+	_valign_,
+	_bgcolor_,
+	_cellspacing_,
+	_cellpadding_,
+	_colspan_,
+	_rowspan_,
+	_face_,
+	_size_,
+	_start_,
+
 	// CSS pseudo-elements
 	_before_,
 	_after_,
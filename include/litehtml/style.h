@@ -90,6 +90,16 @@ namespace litehtml
 			: m_size_vector(vec), m_type(prop_type_size_vector), m_important(important)
 		{
 		}
+		property_value(const property_value& val)
+			: m_type(prop_type_invalid)
+		{
+			*this = val;
+		}
+		property_value(property_value&& val) noexcept
+			: m_type(prop_type_invalid)
+		{
+			*this = std::move(val);
+		}
 		~property_value()
 		{
 			switch (m_type)
@@ -160,11 +170,55 @@ namespace litehtml
 				break;
 			}
 
+			return *this;
+		}
+		property_value& operator=(property_value&& val) noexcept
+		{
+			if (this == &val) return *this;
+			this->~property_value();
+
+			m_type		= val.m_type;
+			m_important	= val.m_important;
+			switch (val.m_type)
+			{
+			case prop_type_string:
+			case prop_type_var:
+				new(&m_string) string(std::move(val.m_string));
+				break;
+			case prop_type_string_vector:
+				new(&m_string_vector) string_vector(std::move(val.m_string_vector));
+				break;
+			case prop_type_enum_item:
+				m_enum_item = val.m_enum_item;
+				break;
+			case prop_type_enum_item_vector:
+				new(&m_enum_item_vector) int_vector(std::move(val.m_enum_item_vector));
+				break;
+			case prop_type_length:
+				new(&m_length) css_length(val.m_length);
+				break;
+			case prop_type_length_vector:
+				new(&m_length_vector) length_vector(std::move(val.m_length_vector));
+				break;
+			case prop_type_number:
+				m_number = val.m_number;
+				break;
+			case prop_type_color:
+				new(&m_color) web_color(val.m_color);
+				break;
+			case prop_type_size_vector:
+				new(&m_size_vector) size_vector(std::move(val.m_size_vector));
+				break;
+			default:
+				break;
+			}
+
 			return *this;
 		}
 	};
 
-	typedef std::map<string_id, property_value>	props_map;
+	// Properties sorted by name: a flat vector instead of a tree, searched with binary search
+	typedef std::vector<std::pair<string_id, property_value>>	props_map;
 
 	class style
 	{
@@ -173,7 +227,7 @@ namespace litehtml
 		typedef std::vector<style::ptr>		vector;
 	private:
 		props_map							m_properties;
-		static std::map<string_id, string>	m_valid_values;
+		static const std::map<string_id, string>	m_valid_values;
 	public:
 		void add(const string& txt, const string& baseurl = "", document_container* container = nullptr)
 		{
@@ -183,6 +237,8 @@ namespace litehtml
 		void add_property(string_id name, const string& val, const string& baseurl = "", bool important = false, document_container* container = nullptr);
 
 		const property_value& get_property(string_id name) const;
+		// what must be redone when an element gets or loses these properties
+		style_change get_change() const;
 
 		void combine(const style& src);
 		void clear()
@@ -210,9 +266,12 @@ namespace litehtml
 		static void parse_two_lengths(const string& str, css_length len[2]);
 		static int parse_four_lengths(const string& str, css_length len[4]);
 		static void subst_vars_(string& str, const element* el);
+		static const string& valid_values(string_id name);
 
 		void add_parsed_property(string_id name, const property_value& propval);
 		void remove_property(string_id name, bool important);
+		props_map::iterator find_property(string_id name);
+		props_map::const_iterator find_property(string_id name) const;
 	};
 }
 
@@ -0,0 +1,33 @@
+#ifndef LH_STYLE_SHARING_CACHE_H
+#define LH_STYLE_SHARING_CACHE_H
+
+#include <memory>
+
+namespace litehtml
+{
+	class html_tag;
+
+	// Keeps the last computed elements, so their siblings with the same tag, attributes
+	// and matched rules can copy the computed css_properties instead of resolving them again.
+	class style_sharing_cache
+	{
+	public:
+		static const int max_candidates = 8;
+	private:
+		std::weak_ptr<html_tag>	m_candidates[max_candidates];
+		int						m_next;
+		int						m_hits;
+		int						m_misses;
+	public:
+		style_sharing_cache() : m_next(0), m_hits(0), m_misses(0) {}
+
+		std::shared_ptr<html_tag>	find(const html_tag& el);
+		void						add(const std::shared_ptr<html_tag>& el);
+		void						clear();
+
+		int hits() const	{ return m_hits; }
+		int misses() const	{ return m_misses; }
+	};
+}
+
+#endif  // LH_STYLE_SHARING_CACHE_H
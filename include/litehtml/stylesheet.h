@@ -10,11 +10,26 @@ namespace litehtml
 
 	class css
 	{
+		typedef std::map<string_id, css_selector::vector>	selectors_map;
+
 		css_selector::vector	m_selectors;
+		// Rule buckets keyed on the rightmost compound selector. Filled in sort_selectors().
+		selectors_map			m_id_selectors;
+		selectors_map			m_class_selectors;
+		selectors_map			m_tag_selectors;
+		css_selector::vector	m_universal_selectors;
 	public:
+		typedef std::shared_ptr<css>		ptr;
+		typedef std::shared_ptr<const css>	const_ptr;
+
 		css() = default;
 		~css() = default;
 
+		// Parses and sorts a stylesheet that is not bound to a document, so any number of documents
+		// on any threads can share it. It must be self-contained: @import rules are ignored and
+		// the rules inside @media never apply.
+		static const_ptr create_shared(const char* str);
+
 		const css_selector::vector& selectors() const
 		{
 			return m_selectors;
@@ -23,16 +38,23 @@ namespace litehtml
 		void clear()
 		{
 			m_selectors.clear();
+			m_id_selectors.clear();
+			m_class_selectors.clear();
+			m_tag_selectors.clear();
+			m_universal_selectors.clear();
 		}
 
 		void	parse_stylesheet(const char* str, const char* baseurl, const std::shared_ptr<document>& doc, const media_query_list::ptr& media);
+		void	add_selectors(const css& src, const media_query_list::ptr& media, const std::shared_ptr<document>& doc);
 		void	sort_selectors();
+		void	get_candidate_selectors(string_id tag, string_id id, const std::vector<string_id>& classes, css_selector::vector& res) const;
 		static void	parse_css_url(const string& str, string& url);
 
 	private:
 		void	parse_atrule(const string& text, const char* baseurl, const std::shared_ptr<document>& doc, const media_query_list::ptr& media);
 		void	add_selector(const css_selector::ptr& selector);
 		bool	parse_selectors(const string& txt, const style::ptr& styles, const media_query_list::ptr& media);
+		void	build_buckets();
 
 	};
 
@@ -0,0 +1,99 @@
+#ifndef LH_STYLESHEET_CACHE_H
+#define LH_STYLESHEET_CACHE_H
+
+#include <list>
+#include <map>
+#include "stylesheet.h"
+
+#ifndef LITEHTML_NO_THREADS
+	#include <mutex>
+#endif
+
+namespace litehtml
+{
+	// Process-wide cache of the parsed document stylesheets (<style>, <link> and the stylesheets
+	// they @import). The cache is disabled by default. After set_enabled(true) the documents of the
+	// same container that load the same CSS text with the same base url share the parsed rules
+	// read-only and copy only the selectors into their own litehtml::css.
+	// The container is a part of the key because the parsed rules depend on its import_css() and
+	// resolve_color(), so clear(container) must be called before a container is deleted. On a hit
+	// the stylesheet is not parsed again: import_css() and resolve_color() are not called and the
+	// rules of the @import-ed stylesheets are the ones loaded by the first document. Call
+	// clear(container) when they change.
+	// The least recently used stylesheets are evicted when the total length of the cached CSS text
+	// exceeds max_size().
+	class stylesheet_cache
+	{
+	public:
+		struct statistics
+		{
+			int		hits		= 0;
+			int		misses		= 0;
+			int		evictions	= 0;
+			int		entries		= 0;
+			size_t	size		= 0;	// total length of the cached CSS text
+		};
+
+		static const size_t default_max_size = 4 * 1024 * 1024;
+
+	private:
+		struct key
+		{
+			const document_container*	container;
+			size_t						hash;
+			string						baseurl;
+			int							font_size;	// em units in @media are converted with the default font size
+
+			bool operator<(const key& val) const
+			{
+				if(container != val.container) return std::less<const document_container*>()(container, val.container);
+				if(hash != val.hash) return hash < val.hash;
+				if(font_size != val.font_size) return font_size < val.font_size;
+				return baseurl < val.baseurl;
+			}
+		};
+
+		struct entry
+		{
+			key				k;
+			string			text;
+			css::const_ptr	sheet;
+		};
+		typedef std::list<entry>	entries_list;
+
+		entries_list								m_entries;	// most recently used first
+		std::map<key, entries_list::iterator>		m_index;
+		size_t										m_max_size;
+		bool										m_enabled;
+		statistics									m_stats;
+#ifndef LITEHTML_NO_THREADS
+		mutable std::mutex							m_mutex;
+#endif
+	public:
+		stylesheet_cache() : m_max_size(default_max_size), m_enabled(false) {}
+
+		static stylesheet_cache& instance();
+
+		bool			enabled() const;
+		// disabling the cache removes the cached stylesheets
+		void			set_enabled(bool enabled);
+
+		// returns nullptr if the stylesheet is not cached
+		css::const_ptr	find(const document_container* container, const string& text, const string& baseurl, int font_size);
+		void			add(const document_container* container, const string& text, const string& baseurl, int font_size, const css::const_ptr& sheet);
+		void			clear();
+		// removes the stylesheets of the container
+		void			clear(const document_container* container);
+
+		size_t			max_size() const;
+		void			set_max_size(size_t max_size);
+		statistics		get_statistics() const;
+
+	private:
+		static size_t	hash(const string& text);
+		void			erase(entries_list::iterator iter);
+		void			evict(size_t max_size);
+	};
+}
+
+#endif  // LH_STYLESHEET_CACHE_H
@@ -0,0 +1,73 @@
+#ifndef LH_TEXT_WIDTH_CACHE_H
+#define LH_TEXT_WIDTH_CACHE_H
+
+#include <list>
+#include <unordered_map>
+#include "types.h"
+
+namespace litehtml
+{
+	// Widths of the measured texts by font, most words of a page repeat many times and are measured
+	// again by every compute_styles(). Owned by the document, the fonts are valid while the document lives.
+	// The least recently used widths are evicted when there are more than max_entries() of them.
+	// set_max_entries(0) disables the cache.
+	class text_width_cache
+	{
+	public:
+		struct statistics
+		{
+			int		hits		= 0;
+			int		misses		= 0;
+			int		evictions	= 0;
+			int		entries		= 0;
+		};
+
+		static const size_t default_max_entries = 8192;
+
+	private:
+		struct key
+		{
+			uint_ptr	font;
+			string		text;
+
+			bool operator==(const key& val) const
+			{
+				return font == val.font && text == val.text;
+			}
+		};
+
+		struct key_hash
+		{
+			size_t operator()(const key& k) const;
+		};
+
+		struct entry
+		{
+			int									width;
+			std::list<const key*>::iterator		lru;
+		};
+
+		std::unordered_map<key, entry, key_hash>	m_index;
+		std::list<const key*>						m_lru;		// the keys in m_index, most recently used first
+		size_t										m_max_entries;
+		statistics									m_stats;
+		key											m_lookup;	// reused to avoid the allocations of the long texts
+
+	public:
+		text_width_cache() : m_max_entries(default_max_entries) {}
+
+		// returns false if the width is not cached
+		bool				find(uint_ptr font, const char* text, int& width);
+		void				add(uint_ptr font, const char* text, int width);
+		void				clear();
+
+		size_t				max_entries() const	{ return m_max_entries; }
+		void				set_max_entries(size_t max_entries);
+		const statistics&	get_statistics() const	{ return m_stats; }
+
+	private:
+		void				evict(size_t max_entries);
+	};
+}
+
+#endif  // LH_TEXT_WIDTH_CACHE_H
@@ -7,6 +7,7 @@
 #include <map>
 #include <vector>
 #include <list>
+#include <algorithm>
 
 namespace litehtml
 {
@@ -131,6 +132,17 @@ namespace litehtml
 				val->top()		<= bottom()			);
 		}
 
+		// extends the position to contain val
+		void unite(const position& val)
+		{
+			int r = std::max(right(), val.right());
+			int b = std::max(bottom(), val.bottom());
+			x		= std::min(x, val.x);
+			y		= std::min(y, val.y);
+			width	= r - x;
+			height	= b - y;
+		}
+
 		bool empty() const
 		{
 			if(!width && !height)
@@ -175,8 +187,6 @@ namespace litehtml
 		font_metrics	metrics;
 	};
 
-	typedef std::map<string, font_item> fonts_map;
-
 	enum draw_flag
 	{
 		draw_root,
@@ -224,6 +234,11 @@ namespace litehtml
 				type = v.type;
 				return *this;
 			}
+
+			bool operator==(const typed_int& v) const
+			{
+				return value == v.value && type == v.type;
+			}
 		};
 
 		typed_int width;						// width of the containing block
@@ -248,6 +263,18 @@ namespace litehtml
 				context_idx(0)
 		{}
 
+		bool operator==(const containing_block_context& val) const
+		{
+			return	width == val.width &&
+					render_width == val.render_width &&
+					min_width == val.min_width &&
+					max_width == val.max_width &&
+					height == val.height &&
+					min_height == val.min_height &&
+					max_height == val.max_height &&
+					context_idx == val.context_idx;
+		}
+
 		containing_block_context new_width(int w) const
 		{
 			containing_block_context ret = *this;
@@ -827,6 +854,15 @@ namespace litehtml
 		render_fixed_only,
 	};
 
+	// What has to be redone after the styles of an element were changed
+	enum style_change
+	{
+		style_change_none,
+		style_change_style,		// nothing is drawn differently (e.g. cursor)
+		style_change_paint,		// the element must be redrawn, the layout is the same
+		style_change_layout,	// the document must be laid out again
+	};
+
 	// List of the Void Elements (can't have any contents)
 	const char* const void_elements = "area;base;br;col;command;embed;hr;img;input;keygen;link;meta;param;source;track;wbr";
 
@@ -11,12 +11,15 @@ SOURCES = \
     $$PWD/containers/test/lodepng.cpp \
     $$PWD/containers/test/test_container.cpp \
     $$PWD/containers/win32/win32_container.cpp \
+    $$PWD/src/ancestor_filter.cpp \
     $$PWD/src/codepoint.cpp \
     $$PWD/src/css_borders.cpp \
     $$PWD/src/css_length.cpp \
     $$PWD/src/css_properties.cpp \
     $$PWD/src/css_selector.cpp \
+    $$PWD/src/display_list.cpp \
     $$PWD/src/document.cpp \
+    $$PWD/src/document_builder.cpp \
     $$PWD/src/document_container.cpp \
     $$PWD/src/element.cpp \
     $$PWD/src/el_anchor.cpp \
@@ -39,6 +42,7 @@ SOURCES = \
     $$PWD/src/el_text.cpp \
     $$PWD/src/el_title.cpp \
     $$PWD/src/el_tr.cpp \
+    $$PWD/src/font_cache.cpp \
     $$PWD/src/formatting_context.cpp \
     $$PWD/src/html.cpp \
     $$PWD/src/html_tag.cpp \
@@ -46,6 +50,7 @@ SOURCES = \
     $$PWD/src/line_box.cpp \
     $$PWD/src/media_query.cpp \
     $$PWD/src/num_cvt.cpp \
+    $$PWD/src/object_pool.cpp \
     $$PWD/src/render_block.cpp \
     $$PWD/src/render_block_context.cpp \
     $$PWD/src/render_flex.cpp \
@@ -56,8 +61,11 @@ SOURCES = \
     $$PWD/src/string_id.cpp \
     $$PWD/src/strtod.cpp \
     $$PWD/src/style.cpp \
+    $$PWD/src/style_sharing_cache.cpp \
     $$PWD/src/stylesheet.cpp \
+    $$PWD/src/stylesheet_cache.cpp \
     $$PWD/src/table.cpp \
+    $$PWD/src/text_width_cache.cpp \
     $$PWD/src/tstring_view.cpp \
     $$PWD/src/url.cpp \
     $$PWD/src/url_path.cpp \
@@ -65,8 +73,18 @@ SOURCES = \
     $$PWD/src/web_color.cpp \
     $$PWD/test/codepoint_test.cpp \
     $$PWD/test/cssTest.cpp \
+    $$PWD/test/display_list_test.cpp \
+    $$PWD/test/document_builder_test.cpp \
+    $$PWD/test/document_test.cpp \
+    $$PWD/test/font_cache_test.cpp \
     $$PWD/test/mediaQueryTest.cpp \
+    $$PWD/test/object_pool_test.cpp \
     $$PWD/test/render_test.cpp \
+    $$PWD/test/split_text_test.cpp \
+    $$PWD/test/string_id_test.cpp \
+    $$PWD/test/stylesheet_cache_test.cpp \
+    $$PWD/test/text_width_cache_test.cpp \
+    $$PWD/test/thread_test.cpp \
     $$PWD/test/tstring_view_test.cpp \
     $$PWD/test/url_path_test.cpp \
     $$PWD/test/url_test.cpp
@@ -84,6 +102,7 @@ HEADERS = \
     $$PWD/containers/test/lodepng.h \
     $$PWD/containers/test/test_container.h \
     $$PWD/containers/win32/win32_container.h \
+    $$PWD/include/litehtml/ancestor_filter.h \
     $$PWD/include/litehtml/background.h \
     $$PWD/include/litehtml/borders.h \
     $$PWD/include/litehtml/codepoint.h \
@@ -93,7 +112,9 @@ HEADERS = \
     $$PWD/include/litehtml/css_position.h \
     $$PWD/include/litehtml/css_properties.h \
     $$PWD/include/litehtml/css_selector.h \
+    $$PWD/include/litehtml/display_list.h \
     $$PWD/include/litehtml/document.h \
+    $$PWD/include/litehtml/document_builder.h \
     $$PWD/include/litehtml/document_container.h \
     $$PWD/include/litehtml/element.h \
     $$PWD/include/litehtml/el_anchor.h \
@@ -116,6 +137,7 @@ HEADERS = \
     $$PWD/include/litehtml/el_text.h \
     $$PWD/include/litehtml/el_title.h \
     $$PWD/include/litehtml/el_tr.h \
+    $$PWD/include/litehtml/font_cache.h \
     $$PWD/include/litehtml/formatting_context.h \
     $$PWD/include/litehtml/html.h \
     $$PWD/include/litehtml/html_tag.h \
@@ -124,6 +146,7 @@ HEADERS = \
     $$PWD/include/litehtml/master_css.h \
     $$PWD/include/litehtml/media_query.h \
     $$PWD/include/litehtml/num_cvt.h \
+    $$PWD/include/litehtml/object_pool.h \
     $$PWD/include/litehtml/os_types.h \
     $$PWD/include/litehtml/render_block.h \
     $$PWD/include/litehtml/render_block_context.h \
@@ -133,10 +156,14 @@ HEADERS = \
     $$PWD/include/litehtml/render_inline_context.h \
     $$PWD/include/litehtml/render_item.h \
     $$PWD/include/litehtml/render_table.h \
+    $$PWD/include/litehtml/render_text.h \
     $$PWD/include/litehtml/string_id.h \
     $$PWD/include/litehtml/style.h \
+    $$PWD/include/litehtml/style_sharing_cache.h \
     $$PWD/include/litehtml/stylesheet.h \
+    $$PWD/include/litehtml/stylesheet_cache.h \
     $$PWD/include/litehtml/table.h \
+    $$PWD/include/litehtml/text_width_cache.h \
     $$PWD/include/litehtml/tstring_view.h \
     $$PWD/include/litehtml/types.h \
     $$PWD/include/litehtml/url.h \
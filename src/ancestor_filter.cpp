@@ -0,0 +1,43 @@
+#include "html.h"
+#include "ancestor_filter.h"
+#include "css_selector.h"
+
+void litehtml::ancestor_filter::push_element(string_id tag, string_id id, const std::vector<string_id>& classes)
+{
+	add(tag_hash(tag));
+	if(id != empty_id)
+	{
+		add(id_hash(id));
+	}
+	for(auto cls : classes)
+	{
+		add(class_hash(cls));
+	}
+	m_depth++;
+}
+
+void litehtml::ancestor_filter::pop_element(string_id tag, string_id id, const std::vector<string_id>& classes)
+{
+	remove(tag_hash(tag));
+	if(id != empty_id)
+	{
+		remove(id_hash(id));
+	}
+	for(auto cls : classes)
+	{
+		remove(class_hash(cls));
+	}
+	m_depth--;
+}
+
+bool litehtml::ancestor_filter::may_match(const css_selector& selector) const
+{
+	for(int i = 0; i < max_selector_hashes && selector.m_ancestor_hashes[i]; i++)
+	{
+		if(!may_contain(selector.m_ancestor_hashes[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -347,8 +347,8 @@ void litehtml::css_properties::compute_font(const element* el, const document::p
 	m_font = doc->get_font(
 		m_font_family.c_str(), 
 		font_size, 
-		index_value(m_font_weight, font_weight_strings).c_str(), 
-		index_value(m_font_style, font_style_strings).c_str(),
+		m_font_weight,
+		m_font_style,
 		m_text_decoration.c_str(), 
 		&m_font_metrics);
 }
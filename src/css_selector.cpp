@@ -311,6 +311,47 @@ void litehtml::css_selector::calc_specificity()
 	}
 }
 
+void litehtml::css_selector::calc_ancestor_hashes()
+{
+	memset(m_ancestor_hashes, 0, sizeof(m_ancestor_hashes));
+
+	int count = 0;
+	auto add_hash = [&](unsigned hash)
+		{
+			if(count < ancestor_filter::max_selector_hashes)
+			{
+				m_ancestor_hashes[count++] = hash;
+			}
+		};
+
+	// The compound on the left of a descendant/child combinator is an ancestor of the element
+	// on its right, and so an ancestor of the subject too (siblings share the parent).
+	const css_selector* sel = this;
+	while(sel->m_left && count < ancestor_filter::max_selector_hashes)
+	{
+		bool is_ancestor = sel->m_combinator == combinator_descendant || sel->m_combinator == combinator_child;
+		sel = sel->m_left.get();
+		if(!is_ancestor)
+		{
+			continue;
+		}
+		for(const auto& attr : sel->m_right.m_attrs)
+		{
+			if(attr.type == select_id)
+			{
+				add_hash(ancestor_filter::id_hash(attr.name));
+			} else if(attr.type == select_class)
+			{
+				add_hash(ancestor_filter::class_hash(attr.name));
+			}
+		}
+		if(sel->m_right.m_tag != star_id)
+		{
+			add_hash(ancestor_filter::tag_hash(sel->m_right.m_tag));
+		}
+	}
+}
+
 void litehtml::css_selector::add_media_to_doc( document* doc ) const
 {
 	if(m_media_query && doc)
@@ -0,0 +1,203 @@
+#include "html.h"
+#include "display_list.h"
+
+namespace litehtml
+{
+	// Records the drawing calls into a display_list and forwards all other calls to the document container
+	class display_list_recorder : public document_container
+	{
+		display_list&		m_list;
+		document_container*	m_container;
+		std::vector<int>	m_open_clips;	// the indexes of the op_set_clip without op_del_clip yet
+	public:
+		display_list_recorder(display_list& list, document_container* container) : m_list(list), m_container(container) {}
+
+		uint_ptr create_font(const char* faceName, int size, int weight, font_style italic, unsigned int decoration, font_metrics* fm) override
+		{
+			return m_container->create_font(faceName, size, weight, italic, decoration, fm);
+		}
+		void delete_font(uint_ptr hFont) override							{ m_container->delete_font(hFont); }
+		int text_width(const char* text, uint_ptr hFont) override			{ return m_container->text_width(text, hFont); }
+		void text_widths(std::vector<text_measurement>& items) override	{ m_container->text_widths(items); }
+		int pt_to_px(int pt) const override									{ return m_container->pt_to_px(pt); }
+		int get_default_font_size() const override							{ return m_container->get_default_font_size(); }
+		const char* get_default_font_name() const override					{ return m_container->get_default_font_name(); }
+		void load_image(const char* src, const char* baseurl, bool redraw_on_ready) override	{ m_container->load_image(src, baseurl, redraw_on_ready); }
+		void get_image_size(const char* src, const char* baseurl, size& sz) override			{ m_container->get_image_size(src, baseurl, sz); }
+		void set_caption(const char* caption) override						{ m_container->set_caption(caption); }
+		void set_base_url(const char* base_url) override					{ m_container->set_base_url(base_url); }
+		void link(const std::shared_ptr<document>& doc, const element::ptr& el) override	{ m_container->link(doc, el); }
+		void on_anchor_click(const char* url, const element::ptr& el) override	{ m_container->on_anchor_click(url, el); }
+		void set_cursor(const char* cursor) override						{ m_container->set_cursor(cursor); }
+		void transform_text(string& text, text_transform tt) override		{ m_container->transform_text(text, tt); }
+		void import_css(string& text, const string& url, string& baseurl) override	{ m_container->import_css(text, url, baseurl); }
+		void get_client_rect(position& client) const override				{ m_container->get_client_rect(client); }
+		element::ptr create_element(const char* tag_name, const string_map& attributes, const std::shared_ptr<document>& doc) override
+		{
+			return m_container->create_element(tag_name, attributes, doc);
+		}
+		void get_media_features(media_features& media) const override		{ m_container->get_media_features(media); }
+		void get_language(string& language, string& culture) const override	{ m_container->get_language(language, culture); }
+		string resolve_color(const string& color) const override			{ return m_container->resolve_color(color); }
+		void split_text(const char* text, const std::function<void(tstring_view)>& on_word, const std::function<void(tstring_view)>& on_space) override
+		{
+			m_container->split_text(text, on_word, on_space);
+		}
+
+		void draw_text(uint_ptr hdc, const char* text, uint_ptr hFont, web_color color, const position& pos) override
+		{
+			add_op(display_list::op_text, (int) m_list.m_texts.size(), pos);
+			m_list.m_texts.push_back({m_list.m_text.size(), hFont, color, pos});
+			m_list.m_text.append(text ? text : "");
+			m_list.m_text.push_back('\0');
+		}
+
+		void draw_list_marker(uint_ptr hdc, const list_marker& marker) override
+		{
+			add_op(display_list::op_list_marker, (int) m_list.m_markers.size(), marker.pos);
+			m_list.m_markers.push_back({marker, marker.baseurl ? marker.baseurl : "", marker.baseurl != nullptr});
+			m_list.m_markers.back().marker.baseurl = nullptr;
+		}
+
+		void draw_background(uint_ptr hdc, const std::vector<background_paint>& bg) override
+		{
+			position bounds = bg.front().clip_box;
+			for(const auto& paint : bg)
+			{
+				bounds.unite(paint.clip_box);
+			}
+			add_op(display_list::op_background, (int) m_list.m_backgrounds.size(), bounds);
+			m_list.m_backgrounds.push_back(bg);
+		}
+
+		void draw_borders(uint_ptr hdc, const borders& borders, const position& draw_pos, bool root) override
+		{
+			add_op(display_list::op_borders, (int) m_list.m_borders.size(), draw_pos);
+			m_list.m_borders.push_back({borders, draw_pos, root});
+		}
+
+		void set_clip(const position& pos, const border_radiuses& bdr_radius) override
+		{
+			m_open_clips.push_back((int) m_list.m_ops.size());
+			add_op(display_list::op_set_clip, (int) m_list.m_clips.size(), pos);
+			m_list.m_clips.push_back({pos, bdr_radius});
+		}
+
+		void del_clip() override
+		{
+			if(!m_open_clips.empty())
+			{
+				m_list.m_ops[m_open_clips.back()].end = (int) m_list.m_ops.size();
+				m_open_clips.pop_back();
+			}
+			add_op(display_list::op_del_clip, -1, position());
+		}
+
+	private:
+		void add_op(display_list::op_type type, int data, const position& bounds)
+		{
+			m_list.m_ops.push_back({type, data, -1, bounds});
+		}
+	};
+}
+
+namespace
+{
+	litehtml::position shifted(litehtml::position pos, int x, int y)
+	{
+		pos.x += x;
+		pos.y += y;
+		return pos;
+	}
+}
+
+void litehtml::display_list::clear()
+{
+	m_ops.clear();
+	m_text.clear();
+	m_texts.clear();
+	m_markers.clear();
+	m_backgrounds.clear();
+	m_borders.clear();
+	m_clips.clear();
+}
+
+void litehtml::display_list::record(document_container* container, const std::function<void(document_container*)>& draw)
+{
+	clear();
+	display_list_recorder recorder(*this, container);
+	draw(&recorder);
+}
+
+void litehtml::display_list::replay(document_container* container, uint_ptr hdc, int x, int y, const position* clip) const
+{
+	for(size_t i = 0; i < m_ops.size(); i++)
+	{
+		const op& cur = m_ops[i];
+		if(cur.type != op_del_clip && (cur.type != op_set_clip || cur.end >= 0) && !shifted(cur.bounds, x, y).does_intersect(clip))
+		{
+			if(cur.type == op_set_clip)
+			{
+				// nothing inside of the clip is visible
+				i = cur.end;
+			}
+			continue;
+		}
+
+		switch(cur.type)
+		{
+			case op_text:
+				{
+					const text_data& text = m_texts[cur.data];
+					container->draw_text(hdc, m_text.c_str() + text.text, text.font, text.color, shifted(text.pos, x, y));
+				}
+				break;
+			case op_list_marker:
+				{
+					const marker_data& data = m_markers[cur.data];
+					list_marker marker = data.marker;
+					marker.baseurl = data.has_baseurl ? data.baseurl.c_str() : nullptr;
+					marker.pos = shifted(marker.pos, x, y);
+					container->draw_list_marker(hdc, marker);
+				}
+				break;
+			case op_background:
+				{
+					std::vector<background_paint> bg = m_backgrounds[cur.data];
+					for(auto& paint : bg)
+					{
+						if(paint.is_root && clip)
+						{
+							// the root background fills the clip, as document::draw() does
+							paint.clip_box = *clip;
+							paint.border_box = *clip;
+						} else
+						{
+							paint.clip_box = shifted(paint.clip_box, x, y);
+							paint.border_box = shifted(paint.border_box, x, y);
+						}
+						paint.origin_box = shifted(paint.origin_box, x, y);
+						paint.position_x += x;
+						paint.position_y += y;
+					}
+					container->draw_background(hdc, bg);
+				}
+				break;
+			case op_borders:
+				{
+					const borders_data& data = m_borders[cur.data];
+					container->draw_borders(hdc, data.bdr, shifted(data.pos, x, y), data.root);
+				}
+				break;
+			case op_set_clip:
+				{
+					const clip_data& data = m_clips[cur.data];
+					container->set_clip(shifted(data.pos, x, y), data.radius);
+				}
+				break;
+			case op_del_clip:
+				container->del_clip();
+				break;
+		}
+	}
+}
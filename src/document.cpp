@@ -29,69 +29,153 @@
 #include "render_item.h"
 #include "render_table.h"
 #include "render_block.h"
+#include "stylesheet_cache.h"
+#include "display_list.h"
+#include <climits>
+#include <chrono>
+
+namespace
+{
+	// measures the time since the previous lap() for document::load_statistics
+	class phase_timer
+	{
+		std::chrono::steady_clock::time_point m_start;
+	public:
+		phase_timer() : m_start(std::chrono::steady_clock::now()) {}
+
+		long long lap()
+		{
+			auto now = std::chrono::steady_clock::now();
+			long long ns = (long long) std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_start).count();
+			m_start = now;
+			return ns;
+		}
+	};
+}
 
 litehtml::document::document(document_container* objContainer)
 {
 	m_container	= objContainer;
+	m_shared_fonts	= font_cache::instance().enabled();
+	m_layout_dirty	= true;
+	m_layout_result	= 0;
+	m_layout_generation	= 0;
+	m_ink_generation	= -1;
+	m_text_batches	= 0;
 }
 
 litehtml::document::~document()
 {
 	m_over_element = nullptr;
+	// the cached widths are valid until the fonts are deleted
+	m_text_widths.clear();
 	if(m_container)
 	{
 		for(auto& font : m_fonts)
 		{
-			m_container->delete_font(font.second.font);
+			if(m_shared_fonts)
+			{
+				font_cache::instance().release(m_container, font.first);
+			} else
+			{
+				m_container->delete_font(font.second.font);
+			}
 		}
 	}
 }
 
 litehtml::document::ptr litehtml::document::createFromString( const char* str, document_container* objPainter, const char* master_styles, const char* user_styles )
 {
-	// parse document into GumboOutput
-	GumboOutput* output = gumbo_parse(str);
-
 	// Create litehtml::document
 	document::ptr doc = std::make_shared<document>(objPainter);
 
-	// Create litehtml::elements.
-	elements_list root_elements;
-	doc->create_node(output->root, root_elements, true);
-	if (!root_elements.empty())
-	{
-		doc->m_root = root_elements.back();
-	}
-	// Destroy GumboOutput
-	gumbo_destroy_output(&kGumboDefaultOptions, output);
-
 	if (master_styles && *master_styles)
 	{
-		doc->m_master_css.parse_stylesheet(master_styles, nullptr, doc, nullptr);
-		doc->m_master_css.sort_selectors();
+		// the default master stylesheet is parsed once and shared by all documents
+		if (master_styles == litehtml::master_css || !strcmp(master_styles, litehtml::master_css))
+		{
+			doc->m_master_css = default_master_css();
+		} else
+		{
+			doc->m_master_css = doc->parse_css(master_styles);
+		}
 	}
 	if (user_styles && *user_styles)
 	{
-		doc->m_user_css.parse_stylesheet(user_styles, nullptr, doc, nullptr);
-		doc->m_user_css.sort_selectors();
+		doc->m_user_css = doc->parse_css(user_styles);
 	}
 
+	doc->load_html(str);
+	return doc;
+}
+
+litehtml::document::ptr litehtml::document::createFromString(const char* str, document_container* objPainter, const css::const_ptr& master_css, const css::const_ptr& user_css)
+{
+	document::ptr doc = std::make_shared<document>(objPainter);
+	doc->m_master_css = master_css;
+	doc->m_user_css = user_css;
+	doc->load_html(str);
+	return doc;
+}
+
+const litehtml::css::const_ptr& litehtml::document::default_master_css()
+{
+	static const css::const_ptr master = css::create_shared(litehtml::master_css);
+	return master;
+}
+
+litehtml::css::const_ptr litehtml::document::parse_css(const char* str)
+{
+	css::ptr sheet = std::make_shared<css>();
+	sheet->parse_stylesheet(str, nullptr, shared_from_this(), nullptr);
+	sheet->sort_selectors();
+	return sheet;
+}
+
+void litehtml::document::load_html(const char* str)
+{
+	m_load_statistics = load_statistics();
+	phase_timer timer;
+
+	// parse document into GumboOutput
+	GumboOutput* output = gumbo_parse(str);
+	m_load_statistics.gumbo_parse += timer.lap();
+
+	// Create litehtml::elements.
+	std::vector<element::ptr> root_elements;
+	create_node(output->root, root_elements, true);
+	if (!root_elements.empty())
+	{
+		m_root = root_elements.back();
+	}
+	// Destroy GumboOutput
+	gumbo_destroy_output(&kGumboDefaultOptions, output);
+	m_load_statistics.create_elements += timer.lap();
+
 	// Let's process created elements tree
-	if (doc->m_root)
+	if (m_root)
 	{
-		doc->container()->get_media_features(doc->m_media);
+		document::ptr doc = shared_from_this();
+
+		container()->get_media_features(m_media);
 
-		doc->m_root->set_pseudo_class(_root_, true);
+		m_root->set_pseudo_class(_root_, true);
+		timer.lap();
 
 		// apply master CSS
-		doc->m_root->apply_stylesheet(doc->m_master_css);
+		if (m_master_css)
+		{
+			m_root->apply_stylesheet(*m_master_css);
+		}
+		m_load_statistics.apply_stylesheets += timer.lap();
 
 		// parse elements attributes
-		doc->m_root->parse_attributes();
+		m_root->parse_attributes();
+		m_load_statistics.parse_attributes += timer.lap();
 
 		// parse style sheets linked in document
 		media_query_list::ptr media;
-		for (const auto& css : doc->m_css)
+		for (const auto& css : m_css)
 		{
 			if (!css.media.empty())
 			{
@@ -101,153 +185,147 @@ litehtml::document::ptr litehtml::document::createFromString( const char* str, d
 			{
 				media = nullptr;
 			}
-			doc->m_styles.parse_stylesheet(css.text.c_str(), css.baseurl.c_str(), doc, media);
+			parse_stylesheet(css, media);
 		}
 		// Sort css selectors using CSS rules.
-		doc->m_styles.sort_selectors();
+		m_styles.sort_selectors();
 
 		// get current media features
-		if (!doc->m_media_lists.empty())
+		if (!m_media_lists.empty())
 		{
-			doc->update_media_lists(doc->m_media);
+			update_media_lists(m_media);
 		}
+		m_load_statistics.parse_stylesheets += timer.lap();
 
 		// Apply parsed styles.
-		doc->m_root->apply_stylesheet(doc->m_styles);
+		m_root->apply_stylesheet(m_styles);
 
 		// Apply user styles if any
-		doc->m_root->apply_stylesheet(doc->m_user_css);
+		if (m_user_css)
+		{
+			m_root->apply_stylesheet(*m_user_css);
+		}
+		m_load_statistics.apply_stylesheets += timer.lap();
 
 		// Initialize m_css
-		doc->m_root->compute_styles();
+		// the candidates of the previous pass can have stale computed styles
+		m_style_sharing_cache.clear();
+		begin_text_batch();
+		m_root->compute_styles();
+		end_text_batch();
+		m_load_statistics.compute_styles += timer.lap();
 
 		// Create rendering tree
-		doc->m_root_render = doc->m_root->create_render_item(nullptr);
+		m_root_render = m_root->create_render_item(nullptr);
 
 		// Now the m_tabular_elements is filled with tabular elements.
 		// We have to check the tabular elements for missing table elements 
 		// and create the anonymous boxes in visual table layout
-		doc->fix_tables_layout();
+		fix_tables_layout();
 
 		// Finally initialize elements
 		// init() return pointer to the render_init element because it can change its type
-		doc->m_root_render = doc->m_root_render->init();
+		m_root_render = m_root_render->init();
+		m_load_statistics.create_render_tree += timer.lap();
 	}
+}
 
-	return doc;
+// The parsed rules are taken from the process-wide stylesheet_cache, if it is enabled, when another
+// document of the container has already loaded the same text.
+void litehtml::document::parse_stylesheet(const css_text& text, const media_query_list::ptr& media)
+{
+	document::ptr doc = shared_from_this();
+	int font_size = m_container->get_default_font_size();
+	stylesheet_cache& cache = stylesheet_cache::instance();
+
+	css::const_ptr sheet = cache.find(m_container, text.text, text.baseurl, font_size);
+	if(!sheet)
+	{
+		css::ptr parsed = std::make_shared<css>();
+		size_t media_lists_count = m_media_lists.size();
+		parsed->parse_stylesheet(text.text.c_str(), text.baseurl.c_str(), doc, nullptr);
+		// add_selectors() registers the copies of the media lists
+		m_media_lists.resize(media_lists_count);
+		cache.add(m_container, text.text, text.baseurl, font_size, parsed);
+		sheet = parsed;
+	}
+	m_styles.add_selectors(*sheet, media, doc);
 }
 
-litehtml::uint_ptr litehtml::document::add_font( const char* name, int size, const char* weight, const char* style, const char* decoration, font_metrics* fm )
+int litehtml::document::text_width(const char* text, uint_ptr font)
 {
-	uint_ptr ret = 0;
+	int width;
+	if(!m_text_widths.find(font, text, width))
+	{
+		width = m_container->text_width(text, font);
+		m_text_widths.add(font, text, width);
+	}
+	return width;
+}
 
-	if(!name)
+void litehtml::document::measure_text(const char* text, uint_ptr font, int& width)
+{
+	if(m_text_batches)
 	{
-		name = m_container->get_default_font_name();
+		m_pending_texts.push_back({text, font, &width});
+	} else
+	{
+		width = text_width(text, font);
 	}
+}
 
-	char strSize[20];
-	t_itoa(size, strSize, 20, 10);
+void litehtml::document::end_text_batch()
+{
+	if(--m_text_batches > 0 || m_pending_texts.empty())
+	{
+		return;
+	}
 
-	string key = name;
-	key += ":";
-	key += strSize;
-	key += ":";
-	key += weight;
-	key += ":";
-	key += style;
-	key += ":";
-	key += decoration;
+	// the same texts are next to each other, they are looked up and measured once
+	auto less = [](const pending_text& a, const pending_text& b)
+		{
+			return a.font != b.font ? a.font < b.font : strcmp(a.text, b.text) < 0;
+		};
+	std::sort(m_pending_texts.begin(), m_pending_texts.end(), less);
 
-	if(m_fonts.find(key) == m_fonts.end())
+	std::vector<text_measurement> items;
+	std::vector<std::pair<size_t, size_t>> ranges;	// the pending texts of every item
+	for(size_t i = 0; i < m_pending_texts.size();)
 	{
-		font_style fs = (font_style) value_index(style, font_style_strings, font_style_normal);
-		int	fw = value_index(weight, font_weight_strings, -1);
-		if(fw >= 0)
+		const pending_text& text = m_pending_texts[i];
+		size_t end = i + 1;
+		while(end < m_pending_texts.size() && !less(text, m_pending_texts[end]))
 		{
-			switch(fw)
+			end++;
+		}
+		int width;
+		if(m_text_widths.find(text.font, text.text, width))
+		{
+			for(; i < end; i++)
 			{
-			case litehtml::font_weight_bold:
-				fw = 700;
-				break;
-			case litehtml::font_weight_bolder:
-				fw = 600;
-				break;
-			case litehtml::font_weight_lighter:
-				fw = 300;
-				break;
-			case litehtml::font_weight_normal:
-				fw = 400;
-				break;
-			case litehtml::font_weight_100:
-				fw = 100;
-				break;
-			case litehtml::font_weight_200:
-				fw = 200;
-				break;
-			case litehtml::font_weight_300:
-				fw = 300;
-				break;
-			case litehtml::font_weight_400:
-				fw = 400;
-				break;
-			case litehtml::font_weight_500:
-				fw = 500;
-				break;
-			case litehtml::font_weight_600:
-				fw = 600;
-				break;
-			case litehtml::font_weight_700:
-				fw = 700;
-				break;
-			case litehtml::font_weight_800:
-				fw = 800;
-				break;
-			case litehtml::font_weight_900:
-				fw = 900;
-				break;
+				*m_pending_texts[i].width = width;
 			}
 		} else
 		{
-			fw = atoi(weight);
-			if(fw < 100)
-			{
-				fw = 400;
-			}
+			items.push_back({text.text, text.font, 0});
+			ranges.emplace_back(i, end);
+			i = end;
 		}
+	}
 
-		unsigned int decor = 0;
-
-		if(decoration)
+	if(!items.empty())
+	{
+		m_container->text_widths(items);
+		for(size_t item = 0; item < items.size(); item++)
 		{
-			std::vector<string> tokens;
-			split_string(decoration, tokens, " ");
-			for(auto & token : tokens)
+			m_text_widths.add(items[item].font, items[item].text, items[item].width);
+			for(size_t i = ranges[item].first; i < ranges[item].second; i++)
 			{
-				if(!t_strcasecmp(token.c_str(), "underline"))
-				{
-					decor |= font_decoration_underline;
-				} else if(!t_strcasecmp(token.c_str(), "line-through"))
-				{
-					decor |= font_decoration_linethrough;
-				} else if(!t_strcasecmp(token.c_str(), "overline"))
-				{
-					decor |= font_decoration_overline;
-				}
+				*m_pending_texts[i].width = items[item].width;
 			}
 		}
-
-		font_item fi= {0};
-
-		fi.font = m_container->create_font(name, size, fw, fs, decor, &fi.metrics);
-		m_fonts[key] = fi;
-		ret = fi.font;
-		if(fm)
-		{
-			*fm = fi.metrics;
-		}
 	}
-	return ret;
+	m_pending_texts.clear();
 }
 
 litehtml::uint_ptr litehtml::document::get_font( const char* name, int size, const char* weight, const char* style, const char* decoration, font_metrics* fm )
@@ -256,35 +334,59 @@ litehtml::uint_ptr litehtml::document::get_font( const char* name, int size, con
 	{
 		return 0;
 	}
-	if(!name)
+	m_font_lookup.name = name ? name : m_container->get_default_font_name();
+	m_font_lookup.size = size;
+	int fw = value_index(weight, font_weight_strings, -1);
+	if(fw >= 0)
+	{
+		m_font_lookup.weight = font_descriptor::get_weight((font_weight) fw);
+	} else
 	{
-		name = m_container->get_default_font_name();
+		m_font_lookup.weight = atoi(weight);
+		if(m_font_lookup.weight < 100)
+		{
+			m_font_lookup.weight = 400;
+		}
 	}
+	m_font_lookup.style = (font_style) value_index(style, font_style_strings, font_style_normal);
+	m_font_lookup.decoration = font_descriptor::get_decoration(decoration);
+	return get_font(m_font_lookup, fm);
+}
 
-	char strSize[20];
-	t_itoa(size, strSize, 20, 10);
-
-	string key = name;
-	key += ":";
-	key += strSize;
-	key += ":";
-	key += weight;
-	key += ":";
-	key += style;
-	key += ":";
-	key += decoration;
-
-	auto el = m_fonts.find(key);
+litehtml::uint_ptr litehtml::document::get_font(const char* name, int size, font_weight weight, font_style style, const char* decoration, font_metrics* fm)
+{
+	if(!size)
+	{
+		return 0;
+	}
+	m_font_lookup.name = name ? name : m_container->get_default_font_name();
+	m_font_lookup.size = size;
+	m_font_lookup.weight = font_descriptor::get_weight(weight);
+	m_font_lookup.style = style;
+	m_font_lookup.decoration = font_descriptor::get_decoration(decoration);
+	return get_font(m_font_lookup, fm);
+}
 
-	if(el != m_fonts.end())
+litehtml::uint_ptr litehtml::document::get_font(const font_descriptor& descr, font_metrics* fm)
+{
+	auto iter = m_fonts.find(descr);
+	if(iter == m_fonts.end())
 	{
-		if(fm)
+		font_item item = {0};
+		if(m_shared_fonts)
+		{
+			item = font_cache::instance().get(m_container, descr);
+		} else
 		{
-			*fm = el->second.metrics;
+			item.font = m_container->create_font(descr.name.c_str(), descr.size, descr.weight, descr.style, descr.decoration, &item.metrics);
 		}
-		return el->second.font;
+		iter = m_fonts.emplace(descr, item).first;
+	}
+	if(fm)
+	{
+		*fm = iter->second.metrics;
 	}
-	return add_font(name, size, weight, style, decoration, fm);
+	return iter->second.font;
 }
 
 int litehtml::document::render( int max_width, render_type rt )
@@ -292,6 +394,8 @@ int litehtml::document::render( int max_width, render_type rt )
 	int ret = 0;
 	if(m_root)
 	{
+		m_layout_generation++;
+
 		position client_rc;
 		m_container->get_client_rect(client_rc);
 		containing_block_context cb_context;
@@ -317,20 +421,70 @@ int litehtml::document::render( int max_width, render_type rt )
 			m_content_size.width = 0;
 			m_content_size.height = 0;
 			m_root_render->calc_document_size(m_size, m_content_size);
+
+			m_layout_dirty			= false;
+			m_layout_size.width		= max_width;
+			m_layout_size.height	= client_rc.height;
+			m_layout_result			= ret;
 		}
 	}
 	return ret;
 }
 
+int litehtml::document::update_layout(int max_width)
+{
+	if(!m_layout_dirty && m_root)
+	{
+		position client_rc;
+		m_container->get_client_rect(client_rc);
+		if(max_width == m_layout_size.width && client_rc.height == m_layout_size.height)
+		{
+			return m_layout_result;
+		}
+	}
+	return render(max_width);
+}
+
 void litehtml::document::draw( uint_ptr hdc, int x, int y, const position* clip )
 {
+	m_draw_statistics = draw_statistics();
 	if(m_root && m_root_render)
 	{
+		update_ink_boxes();
 		m_root->draw(hdc, x, y, clip, m_root_render);
 		m_root_render->draw_stacking_context(hdc, x, y, clip, true);
 	}
 }
 
+// the ink boxes are used by the drawing and the hit testing, they are calculated on the first use after the layout
+void litehtml::document::update_ink_boxes()
+{
+	if(m_ink_generation != m_layout_generation)
+	{
+		m_root_render->update_ink_box();
+		m_ink_generation = m_layout_generation;
+	}
+}
+
+void litehtml::document::record(display_list& list)
+{
+	m_draw_statistics = draw_statistics();
+	list.record(m_container, [this](document_container* recorder)
+		{
+			if(m_root && m_root_render)
+			{
+				update_ink_boxes();
+				// record everything, display_list::replay() culls by the replay clip
+				position clip(INT_MIN / 4, INT_MIN / 4, INT_MAX / 2, INT_MAX / 2);
+				document_container* container = m_container;
+				m_container = recorder;
+				m_root->draw(0, 0, 0, &clip, m_root_render);
+				m_root_render->draw_stacking_context(0, 0, 0, &clip, true);
+				m_container = container;
+			}
+		});
+}
+
 int litehtml::document::to_pixels( const char* str, int fontSize, bool* is_percent/*= 0*/ ) const
 {
 	if(!str)	return 0;
@@ -454,6 +608,16 @@ void litehtml::document::add_stylesheet( const char* str, const char* baseurl, c
 	}
 }
 
+litehtml::element::ptr litehtml::document::get_element_by_point(int x, int y, int client_x, int client_y)
+{
+	if(!m_root_render)
+	{
+		return nullptr;
+	}
+	update_ink_boxes();
+	return m_root_render->get_element_by_point(x, y, client_x, client_y);
+}
+
 bool litehtml::document::on_mouse_over( int x, int y, int client_x, int client_y, position::vector& redraw_boxes )
 {
 	if(!m_root || !m_root_render)
@@ -461,7 +625,7 @@ bool litehtml::document::on_mouse_over( int x, int y, int client_x, int client_y
 		return false;
 	}
 
-	element::ptr over_el = m_root_render->get_element_by_point(x, y, client_x, client_y);
+	element::ptr over_el = get_element_by_point(x, y, client_x, client_y);
 
 	bool state_was_changed = false;
 
@@ -520,7 +684,7 @@ bool litehtml::document::on_lbutton_down( int x, int y, int client_x, int client
 		return false;
 	}
 
-	element::ptr over_el = m_root_render->get_element_by_point(x, y, client_x, client_y);
+	element::ptr over_el = get_element_by_point(x, y, client_x, client_y);
 
 	bool state_was_changed = false;
 
@@ -581,6 +745,41 @@ bool litehtml::document::on_lbutton_up( int x, int y, int client_x, int client_y
 }
 
 litehtml::element::ptr litehtml::document::create_element(const char* tag_name, const string_map& attributes)
+{
+	element::ptr newTag = create_tag(tag_name, attributes);
+	if(newTag)
+	{
+		for (const auto & attribute : attributes)
+		{
+			newTag->set_attr(attribute.first.c_str(), attribute.second.c_str());
+		}
+	}
+	return newTag;
+}
+
+// moves the attribute values into the element
+litehtml::element::ptr litehtml::document::create_element(const char* tag_name, string_map&& attributes)
+{
+	element::ptr newTag = create_tag(tag_name, attributes);
+	if(newTag)
+	{
+		for (auto & attribute : attributes)
+		{
+			const string& name = attribute.first;
+			// the parser lowercases the names of HTML attributes, but not of SVG ones (viewBox)
+			if(std::none_of(name.begin(), name.end(), [](char c) { return c >= 'A' && c <= 'Z'; }))
+			{
+				newTag->set_attr(_id(name), std::move(attribute.second));
+			} else
+			{
+				newTag->set_attr(name.c_str(), attribute.second.c_str());
+			}
+		}
+	}
+	return newTag;
+}
+
+litehtml::element::ptr litehtml::document::create_tag(const char* tag_name, const string_map& attributes)
 {
 	element::ptr newTag;
 	document::ptr this_doc = shared_from_this();
@@ -644,10 +843,6 @@ litehtml::element::ptr litehtml::document::create_element(const char* tag_name,
 	if(newTag)
 	{
 		newTag->set_tagName(tag_name);
-		for (const auto & attribute : attributes)
-		{
-			newTag->set_attr(attribute.first.c_str(), attribute.second.c_str());
-		}
 	}
 
 	return newTag;
@@ -669,7 +864,11 @@ bool litehtml::document::media_changed()
 	if (update_media_lists(m_media))
 	{
 		m_root->refresh_styles();
+		m_style_sharing_cache.clear();
+		begin_text_batch();
 		m_root->compute_styles();
+		end_text_batch();
+		m_layout_dirty = true;
 		return true;
 	}
 	return false;
@@ -690,7 +889,11 @@ bool litehtml::document::lang_changed()
 			m_culture.clear();
 		}
 		m_root->refresh_styles();
+		m_style_sharing_cache.clear();
+		begin_text_batch();
 		m_root->compute_styles();
+		end_text_batch();
+		m_layout_dirty = true;
 		return true;
 	}
 	return false;
@@ -720,7 +923,9 @@ void litehtml::document::add_media_list( const media_query_list::ptr& list )
 	}
 }
 
-void litehtml::document::create_node(void* gnode, elements_list& elements, bool parseTextNode)
+// Appends the elements created from gnode to the elements vector. The children are created in
+// the same vector and moved into their parent, so one vector is reused for the whole tree.
+void litehtml::document::create_node(void* gnode, std::vector<element::ptr>& elements, bool parseTextNode)
 {
 	auto* node = (GumboNode*)gnode;
 	switch (node->type)
@@ -732,7 +937,7 @@ void litehtml::document::create_node(void* gnode, elements_list& elements, bool
 			for (unsigned int i = 0; i < node->v.element.attributes.length; i++)
 			{
 				attr = (GumboAttribute*)node->v.element.attributes.data[i];
-				attrs[attr->name] = attr->value;
+				attrs.emplace(attr->name, attr->value);
 			}
 
 
@@ -740,7 +945,7 @@ void litehtml::document::create_node(void* gnode, elements_list& elements, bool
 			const char* tag = gumbo_normalized_tagname(node->v.element.tag);
 			if (tag[0])
 			{
-				ret = create_element(tag, attrs);
+				ret = create_element(tag, std::move(attrs));
 			}
 			else
 			{
@@ -749,7 +954,7 @@ void litehtml::document::create_node(void* gnode, elements_list& elements, bool
 					std::string strA;
 					gumbo_tag_from_original_text(&node->v.element.original_tag);
 					strA.append(node->v.element.original_tag.data, node->v.element.original_tag.length);
-					ret = create_element(strA.c_str(), attrs);
+					ret = create_element(strA.c_str(), std::move(attrs));
 				}
 			}
 			if (!strcmp(tag, "script"))
@@ -758,18 +963,16 @@ void litehtml::document::create_node(void* gnode, elements_list& elements, bool
 			}
 			if (ret)
 			{
-				elements_list child;
+				size_t first_child = elements.size();
 				for (unsigned int i = 0; i < node->v.element.children.length; i++)
 				{
-					child.clear();
-					create_node(static_cast<GumboNode*> (node->v.element.children.data[i]), child, parseTextNode);
-					std::for_each(child.begin(), child.end(), 
-						[&ret](element::ptr& el)
-						{
-							ret->appendChild(el);
-						}
-					);
+					create_node(static_cast<GumboNode*> (node->v.element.children.data[i]), elements, parseTextNode);
 				}
+				for (size_t i = first_child; i < elements.size(); i++)
+				{
+					ret->appendChild(elements[i]);
+				}
+				elements.resize(first_child);
 				elements.push_back(ret);
 			}
 		}
@@ -782,9 +985,15 @@ void litehtml::document::create_node(void* gnode, elements_list& elements, bool
 			}
 			else
 			{
+				// all words and spaces of the node are stored in one text run
+				auto text = std::make_shared<el_text>(nullptr, shared_from_this());
 				m_container->split_text(node->v.text.text,
-					[this, &elements](const char* text) { elements.push_back(std::make_shared<el_text>(text, shared_from_this())); },
-					[this, &elements](const char* text) { elements.push_back(std::make_shared<el_space>(text, shared_from_this())); });
+					[&text](tstring_view word) { text->add_segment(word, false); },
+					[&text](tstring_view space) { text->add_segment(space, true); });
+				if (text->segments_count())
+				{
+					elements.push_back(text);
+				}
 			}
 		}
 		break;
@@ -804,10 +1013,15 @@ void litehtml::document::create_node(void* gnode, elements_list& elements, bool
 		break;
 	case GUMBO_NODE_WHITESPACE:
 		{
-			string str = node->v.text.text;
-			for (size_t i = 0; i < str.length(); i++)
+			// every white space character is a segment of the run
+			auto space = std::make_shared<el_space>(nullptr, shared_from_this());
+			for (const char* c = node->v.text.text; *c; c++)
+			{
+				space->add_segment(tstring_view(c, 1), true);
+			}
+			if (space->segments_count())
 			{
-				elements.push_back(std::make_shared<el_space>(str.substr(i, 1).c_str(), shared_from_this()));
+				elements.push_back(space);
 			}
 		}
 		break;
@@ -1020,7 +1234,7 @@ void litehtml::document::append_children_from_string(element& parent, const char
 	GumboOutput* output = gumbo_parse(str);
 
 	// Create litehtml::elements.
-	elements_list child_elements;
+	std::vector<element::ptr> child_elements;
 	create_node(output->root, child_elements, true);
 
 	// Destroy GumboOutput
@@ -1033,7 +1247,10 @@ void litehtml::document::append_children_from_string(element& parent, const char
 		parent.appendChild(child);
 
 		// apply master CSS
-		child->apply_stylesheet(m_master_css);
+		if (m_master_css)
+		{
+			child->apply_stylesheet(*m_master_css);
+		}
 
 		// parse elements attributes
 		child->parse_attributes();
@@ -1042,10 +1259,16 @@ void litehtml::document::append_children_from_string(element& parent, const char
 		child->apply_stylesheet(m_styles);
 
 		// Apply user styles if any
-		child->apply_stylesheet(m_user_css);
+		if (m_user_css)
+		{
+			child->apply_stylesheet(*m_user_css);
+		}
 
 		// Initialize m_css
+		m_style_sharing_cache.clear();
+		begin_text_batch();
 		child->compute_styles();
+		end_text_batch();
 
 		// Now the m_tabular_elements is filled with tabular elements.
 		// We have to check the tabular elements for missing table elements 
@@ -1055,6 +1278,7 @@ void litehtml::document::append_children_from_string(element& parent, const char
 		// Finally initialize elements
 		//child->init();
 	}
+	m_layout_dirty = true;
 }
 
 void litehtml::document::dump(dumper& cout)
@@ -0,0 +1,91 @@
+#include "html.h"
+#include "document_builder.h"
+
+litehtml::document_builder::document_builder(document_container* container, const char* master_styles, const char* user_styles) :
+	m_container(container),
+	m_master_styles(master_styles ? master_styles : ""),
+	m_user_styles(user_styles ? user_styles : ""),
+	m_parsed_length(0),
+	m_finished(false)
+{
+}
+
+void litehtml::document_builder::append(const char* data, size_t length)
+{
+	if(!m_finished && data)
+	{
+		m_html.append(data, length);
+	}
+}
+
+void litehtml::document_builder::finish()
+{
+	m_finished = true;
+}
+
+bool litehtml::document_builder::has_changes() const
+{
+	return !m_document || complete_length() != m_parsed_length;
+}
+
+litehtml::document::ptr litehtml::document_builder::get_document()
+{
+	if(has_changes())
+	{
+		m_parsed_length = complete_length();
+		string html(m_html, 0, m_parsed_length);
+		m_document = document::createFromString(html.c_str(), m_container, m_master_styles.c_str(), m_user_styles.c_str());
+	}
+	return m_document;
+}
+
+// Returns the length of the received html without the unfinished tag, character reference
+// or UTF-8 sequence at the end. The parser would treat them as text or drop them, and they
+// would flash on the screen until the next chunk arrives.
+size_t litehtml::document_builder::complete_length() const
+{
+	size_t len = m_html.length();
+	if(m_finished || !len)
+	{
+		return len;
+	}
+
+	// incomplete UTF-8 sequence
+	size_t lead = len;
+	while(lead > 0 && len - lead < 3 && (m_html[lead - 1] & 0xC0) == 0x80)
+	{
+		lead--;
+	}
+	if(lead > 0)
+	{
+		auto ch = (unsigned char) m_html[lead - 1];
+		size_t seq_len = ch >= 0xF0 ? 4 : ch >= 0xE0 ? 3 : ch >= 0xC0 ? 2 : 1;
+		if(len - lead + 1 < seq_len)
+		{
+			len = lead - 1;
+		}
+	}
+	if(!len)
+	{
+		return 0;
+	}
+
+	// unfinished tag or comment
+	size_t pos = m_html.find_last_of("<>", len - 1);
+	if(pos != string::npos && m_html[pos] == '<')
+	{
+		len = pos;
+	}
+	if(!len)
+	{
+		return 0;
+	}
+
+	// unfinished character reference
+	pos = m_html.find_last_of("&; \t\n\r\f<>", len - 1);
+	if(pos != string::npos && m_html[pos] == '&')
+	{
+		len = pos;
+	}
+	return len;
+}
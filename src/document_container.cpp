@@ -1,44 +1,77 @@
 #include "html.h"
 #include "document_container.h"
 
-void litehtml::document_container::split_text(const char* text, const std::function<void(const char*)>& on_word, const std::function<void(const char*)>& on_space)
+void litehtml::document_container::text_widths(std::vector<text_measurement>& items)
 {
-	std::wstring str;
-	std::wstring str_in = (const wchar_t*)utf8_to_wchar(text);
-	ucode_t c;
-	for (size_t i = 0; i < str_in.length(); i++)
+	for(auto& item : items)
 	{
-		c = (ucode_t)str_in[i];
-		if (c <= ' ' && (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'))
+		item.width = text_width(item.text, item.font);
+	}
+}
+
+namespace
+{
+	// true if one of the 8 bytes at s is white space, a control character or a part of a multibyte character
+	inline bool has_special_byte(const char* s)
+	{
+		uint64_t x;
+		memcpy(&x, s, sizeof(x));
+		return (((x - 0x2121212121212121ull) | x) & 0x8080808080808080ull) != 0;
+	}
+
+	// CJK Unified Ideographs U+4E00..U+9FCC, always three bytes in UTF-8
+	inline bool is_cjk(const unsigned char* s, const unsigned char* end)
+	{
+		if(s[0] < 0xE4 || s[0] > 0xE9 || end - s < 3 || (s[1] & 0xC0) != 0x80 || (s[2] & 0xC0) != 0x80)
+		{
+			return false;
+		}
+		litehtml::ucode_t c = ((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+		return c >= 0x4E00 && c <= 0x9FCC;
+	}
+}
+
+void litehtml::document_container::split_text(const char* text, const std::function<void(tstring_view)>& on_word, const std::function<void(tstring_view)>& on_space)
+{
+	const unsigned char* p = (const unsigned char*) text;
+	const unsigned char* end = p + strlen(text);
+	const unsigned char* word = p;
+	while(p < end)
+	{
+		// printable ASCII is skipped 8 bytes at a time
+		while(end - p >= 8 && !has_special_byte((const char*) p))
+		{
+			p += 8;
+		}
+		if(p == end)
 		{
-			if (!str.empty())
+			break;
+		}
+
+		if(*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r' || *p == '\f')
+		{
+			if(p != word)
 			{
-				on_word(wchar_to_utf8(str.c_str()));
-				str.clear();
+				on_word(tstring_view((const char*) word, p - word));
 			}
-			str += c;
-			on_space(wchar_to_utf8(str.c_str()));
-			str.clear();
-		}
-		// CJK character range
-		else if (c >= 0x4E00 && c <= 0x9FCC)
+			on_space(tstring_view((const char*) p, 1));
+			word = ++p;
+		} else if(*p >= 0x80 && is_cjk(p, end))
 		{
-			if (!str.empty())
+			if(p != word)
 			{
-				on_word(wchar_to_utf8(str.c_str()));
-				str.clear();
+				on_word(tstring_view((const char*) word, p - word));
 			}
-			str += c;
-			on_word(wchar_to_utf8(str.c_str()));
-			str.clear();
-		}
-		else
+			on_word(tstring_view((const char*) p, 3));
+			p += 3;
+			word = p;
+		} else
 		{
-			str += c;
+			p++;
 		}
 	}
-	if (!str.empty())
+	if(word != end)
 	{
-		on_word(wchar_to_utf8(str.c_str()));
+		on_word(tstring_view((const char*) word, end - word));
 	}
 }
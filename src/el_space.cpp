@@ -2,8 +2,20 @@
 #include "document.h"
 #include "el_space.h"
 
-litehtml::el_space::el_space(const char* text, const std::shared_ptr<document>& doc) : el_text(text, doc)
+litehtml::el_space::el_space(const char* text, const std::shared_ptr<document>& doc) : el_text(nullptr, doc)
 {
+	if(text && *text)
+	{
+		add_segment(tstring_view(text, strlen(text)), true);
+	}
+}
+
+litehtml::el_space::el_space(tstring_view text, const std::shared_ptr<document>& doc) : el_text(tstring_view(), doc)
+{
+	if(text.size())
+	{
+		add_segment(text, true);
+	}
 }
 
 bool litehtml::el_space::is_white_space() const
@@ -20,17 +32,7 @@ bool litehtml::el_space::is_white_space() const
 
 bool litehtml::el_space::is_break() const
 {
-	white_space ws = css().get_white_space();
-	if(	ws == white_space_pre ||
-		ws == white_space_pre_line ||
-		ws == white_space_pre_wrap)
-	{
-		if(m_text == "\n")
-		{
-			return true;
-		}
-	}
-	return false;
+	return m_segments.size() == 1 && is_segment_break(0);
 }
 
 bool litehtml::el_space::is_space() const
@@ -40,5 +42,7 @@ bool litehtml::el_space::is_space() const
 
 litehtml::string litehtml::el_space::dump_get_name()
 {
-    return "space: \"" + get_escaped_string(m_text) + "\"";
+	string text;
+	get_text(text);
+    return "space: \"" + get_escaped_string(text) + "\"";
 }
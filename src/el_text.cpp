@@ -1,26 +1,78 @@
 #include "html.h"
 #include "el_text.h"
-#include "render_item.h"
+#include "render_text.h"
 
 litehtml::el_text::el_text(const char* text, const document::ptr& doc) : element(doc)
 {
-	if(text)
+	m_height			= 0;
+	m_draw_spaces		= true;
+    css_w().set_display(display_inline_text);
+	if(text && *text)
 	{
-		m_text = text;
+		add_segment(tstring_view(text, strlen(text)), false);
 	}
-	m_use_transformed	= false;
+}
+
+litehtml::el_text::el_text(tstring_view text, const document::ptr& doc) : element(doc)
+{
+	m_height			= 0;
 	m_draw_spaces		= true;
-    css_w().set_display(display_inline_text);
+	css_w().set_display(display_inline_text);
+	if(text.size())
+	{
+		add_segment(text, false);
+	}
+}
+
+void litehtml::el_text::add_segment(tstring_view text, bool space)
+{
+	segment seg;
+	seg.offset		= (int) m_text.size();
+	seg.transformed	= -1;
+	seg.width		= 0;
+	seg.space		= space;
+	m_segments.push_back(seg);
+	m_text.append(text.data(), text.size());
+	m_text += '\0';
+}
+
+const char* litehtml::el_text::segment_text(int index) const
+{
+	const segment& seg = m_segments[index];
+	return seg.transformed >= 0 ? m_transformed_text.c_str() + seg.transformed : m_text.c_str() + seg.offset;
 }
 
-void litehtml::el_text::get_content_size( size& sz, int max_width )
+bool litehtml::el_text::is_segment_white_space(int index) const
 {
-	sz = m_size;
+	if(!m_segments[index].space)
+	{
+		return false;
+	}
+	white_space ws = css().get_white_space();
+	return ws == white_space_normal || ws == white_space_nowrap || ws == white_space_pre_line;
+}
+
+bool litehtml::el_text::is_segment_break(int index) const
+{
+	if(!m_segments[index].space)
+	{
+		return false;
+	}
+	white_space ws = css().get_white_space();
+	if(ws == white_space_pre || ws == white_space_pre_line || ws == white_space_pre_wrap)
+	{
+		const char* text = m_text.c_str() + m_segments[index].offset;
+		return text[0] == '\n' && !text[1];
+	}
+	return false;
 }
 
 void litehtml::el_text::get_text( string& text )
 {
-	text += m_text;
+	for(const auto& seg : m_segments)
+	{
+		text += m_text.c_str() + seg.offset;
+	}
 }
 
 void litehtml::el_text::compute_styles(bool recursive)
@@ -37,16 +89,6 @@ void litehtml::el_text::compute_styles(bool recursive)
     css_w().set_display(display_inline_text);
     css_w().set_float(float_none);
 
-	if(m_css.get_text_transform() != text_transform_none)
-	{
-		m_transformed_text	= m_text;
-		m_use_transformed = true;
-		get_document()->container()->transform_text(m_transformed_text, m_css.get_text_transform());
-	} else
-	{
-		m_use_transformed = false;
-	}
-
     element::ptr p = parent();
     while(p && p->css().get_display() == display_inline)
     {
@@ -63,21 +105,40 @@ void litehtml::el_text::compute_styles(bool recursive)
         css_w().set_position(element_position_static);
     }
 
-	if(is_white_space())
-	{
-		m_transformed_text = " ";
-		m_use_transformed = true;
-	} else
+	// all transformed texts are stored before the segments are measured: the measured texts must not move
+	m_transformed_text.clear();
+	text_transform tt = m_css.get_text_transform();
+	string str;
+	for(int i = 0; i < (int) m_segments.size(); i++)
 	{
-		if(m_text == "\t")
+		segment& seg = m_segments[i];
+		const char* text = m_text.c_str() + seg.offset;
+		seg.transformed = -1;
+
+		const char* transformed = nullptr;
+		if(is_segment_white_space(i))
 		{
-			m_transformed_text = "    ";
-			m_use_transformed = true;
+			if(strcmp(text, " ") != 0)
+			{
+				transformed = " ";
+			}
+		} else if(seg.space && !strcmp(text, "\t"))
+		{
+			transformed = "    ";
+		} else if(seg.space && (!strcmp(text, "\n") || !strcmp(text, "\r")))
+		{
+			transformed = "";
+		} else if(tt != text_transform_none)
+		{
+			str = text;
+			get_document()->container()->transform_text(str, tt);
+			transformed = str.c_str();
 		}
-		if(m_text == "\n" || m_text == "\r")
+		if(transformed)
 		{
-			m_transformed_text = "";
-			m_use_transformed = true;
+			seg.transformed = (int) m_transformed_text.size();
+			m_transformed_text += transformed;
+			m_transformed_text += '\0';
 		}
 	}
 
@@ -88,50 +149,65 @@ void litehtml::el_text::compute_styles(bool recursive)
 		font = el_parent->css().get_font();
         fm = el_parent->css().get_font_metrics();
 	}
-	if(is_break() || !font)
+	m_height = font ? fm.height : 0;
+	for(int i = 0; i < (int) m_segments.size(); i++)
 	{
-		m_size.height	= 0;
-		m_size.width	= 0;
-	} else
-	{
-		m_size.height	= fm.height;
-		m_size.width	= get_document()->container()->text_width(m_use_transformed ? m_transformed_text.c_str() : m_text.c_str(), font);
+		segment& seg = m_segments[i];
+		if(is_segment_break(i) || !font)
+		{
+			seg.width = 0;
+		} else
+		{
+			get_document()->measure_text(segment_text(i), font, seg.width);
+		}
 	}
 	m_draw_spaces = fm.draw_spaces;
 }
 
 void litehtml::el_text::draw(uint_ptr hdc, int x, int y, const position *clip, const std::shared_ptr<render_item> &ri)
 {
-	if(is_white_space() && !m_draw_spaces)
+	auto run = dynamic_cast<render_item_text*>(ri.get());
+	element::ptr el_parent = parent();
+	if(!run || !el_parent)
 	{
 		return;
 	}
+	uint_ptr font = el_parent->css().get_font();
+	if(!font)
+	{
+		return;
+	}
+	document::ptr doc = get_document();
+	web_color color = el_parent->css().get_color();
 
-	position pos = ri->pos();
-	pos.x	+= x;
-	pos.y	+= y;
-
-	if(pos.does_intersect(clip))
+	for(int i = 0; i < run->boxes_count(); i++)
 	{
-		element::ptr el_parent = parent();
-		if (el_parent)
+		if(run->is_box_skipped(i) || (is_segment_white_space(i) && !m_draw_spaces))
 		{
-			document::ptr doc = get_document();
-
-			uint_ptr font = el_parent->css().get_font();
-			if(font)
-			{
-				web_color color = el_parent->css().get_color();
-				doc->container()->draw_text(hdc, m_use_transformed ? m_transformed_text.c_str() : m_text.c_str(), font,
-											color, pos);
-			}
+			continue;
+		}
+		position pos = run->box(i);
+		pos.x	+= x;
+		pos.y	+= y;
+		if(pos.does_intersect(clip))
+		{
+			doc->container()->draw_text(hdc, segment_text(i), font, color, pos);
 		}
 	}
 }
 
+std::shared_ptr<litehtml::render_item> litehtml::el_text::create_render_item(const std::shared_ptr<render_item>& parent_ri)
+{
+	auto ret = std::make_shared<render_item_text>(shared_from_this());
+	ret->parent(parent_ri);
+	return ret;
+}
+
 litehtml::string litehtml::el_text::dump_get_name()
 {
-    return "text: \"" + get_escaped_string(m_text) + "\"";
+	string text;
+	get_text(text);
+    return "text: \"" + get_escaped_string(text) + "\"";
 }
 
 std::vector<std::tuple<litehtml::string, litehtml::string>> litehtml::el_text::dump_get_attrs()
@@ -188,8 +188,28 @@ std::shared_ptr<render_item> element::create_render_item(const std::shared_ptr<r
 	return ret;
 }
 
+static bool has_pseudo_element(const css_element_selector& sel)
+{
+	for(const auto& attr : sel.m_attrs)
+	{
+		if(attr.type == select_pseudo_element)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 bool element::requires_styles_update()
 {
+	return get_style_change() != style_change_none;
+}
+
+// Checks which used selectors started or stopped matching (e.g. after :hover was set) and
+// returns the strongest change of their styles
+style_change element::get_style_change()
+{
+	style_change ret = style_change_none;
 	for (const auto& used_style : m_used_styles)
 	{
 		if(used_style->m_selector->is_media_valid())
@@ -197,11 +217,20 @@ bool element::requires_styles_update()
 			int res = select(*(used_style->m_selector), true);
 			if( (res == select_no_match && used_style->m_used) || (res == select_match && !used_style->m_used) )
 			{
-				return true;
+				style_change change = style_change_layout;
+				if(!has_pseudo_element(used_style->m_selector->m_right) && used_style->m_selector->m_style)
+				{
+					change = used_style->m_selector->m_style->get_change();
+				}
+				ret = std::max(ret, change);
+				if(ret == style_change_layout)
+				{
+					break;
+				}
 			}
 		}
 	}
-	return false;
+	return ret;
 }
 
 void element::add_render(const std::shared_ptr<render_item>& ri)
@@ -218,7 +247,8 @@ bool element::find_styles_changes( position::vector& redraw_boxes)
 
 	bool ret = false;
 
-	if(requires_styles_update())
+	style_change change = get_style_change();
+	if(change != style_change_none)
 	{
 		auto fetch_boxes = [&](const std::shared_ptr<element>& el)
 			{
@@ -236,15 +266,25 @@ bool element::find_styles_changes( position::vector& redraw_boxes)
 					}
 				}
 			};
-		fetch_boxes(shared_from_this());
-		for (auto& el : m_children)
+		if(change != style_change_style)
 		{
-			fetch_boxes(el);
+			fetch_boxes(shared_from_this());
+			for (auto& el : m_children)
+			{
+				fetch_boxes(el);
+			}
+			ret = true;
 		}
 
 		refresh_styles();
+		get_document()->get_style_sharing_cache().clear();
+		get_document()->begin_text_batch();
 		compute_styles();
-		ret = true;
+		get_document()->end_text_batch();
+		if(change == style_change_layout)
+		{
+			get_document()->invalidate_layout();
+		}
 	}
 	for (auto& el : m_children)
 	{
@@ -404,6 +444,12 @@ void litehtml::element::reset_counter(const string_id& counter_name_id, const in
 	m_counter_values[counter_name_id] = value;
 }
 
+// elements created by the container may override only the const char* version
+void litehtml::element::set_attr(string_id name, string&& val)
+{
+	set_attr(_s(name).c_str(), val.c_str());
+}
+
 const background* element::get_background(bool own_only)						LITEHTML_RETURN_FUNC(nullptr)
 void element::add_style( const style& style)	        						LITEHTML_EMPTY_FUNC
 void element::select_all(const css_selector& selector, elements_list& res)	LITEHTML_EMPTY_FUNC
@@ -428,6 +474,7 @@ void element::set_data( const char* data )							LITEHTML_EMPTY_FUNC
 void element::set_attr( const char* name, const char* val )			LITEHTML_EMPTY_FUNC
 void element::apply_stylesheet( const litehtml::css& stylesheet )	LITEHTML_EMPTY_FUNC
 void element::refresh_styles()										LITEHTML_EMPTY_FUNC
+void element::update_ancestor_filter(ancestor_filter& filter, bool add) const	LITEHTML_EMPTY_FUNC
 void element::on_click()											LITEHTML_EMPTY_FUNC
 void element::compute_styles( bool recursive )						LITEHTML_EMPTY_FUNC
 const char* element::get_attr( const char* name, const char* def /*= 0*/ ) const LITEHTML_RETURN_FUNC(def)
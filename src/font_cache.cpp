@@ -0,0 +1,244 @@
+#include "html.h"
+#include "font_cache.h"
+#include "document_container.h"
+
+#ifndef LITEHTML_NO_THREADS
+	#define lock_guard(m) std::lock_guard<std::mutex> lock(m)
+#else
+	#define lock_guard(m)
+#endif
+
+int litehtml::font_descriptor::get_weight(font_weight weight)
+{
+	switch(weight)
+	{
+	case font_weight_bold:		return 700;
+	case font_weight_bolder:	return 600;
+	case font_weight_lighter:	return 300;
+	case font_weight_100:		return 100;
+	case font_weight_200:		return 200;
+	case font_weight_300:		return 300;
+	case font_weight_500:		return 500;
+	case font_weight_600:		return 600;
+	case font_weight_700:		return 700;
+	case font_weight_800:		return 800;
+	case font_weight_900:		return 900;
+	default:					return 400;
+	}
+}
+
+unsigned int litehtml::font_descriptor::get_decoration(const char* decoration)
+{
+	unsigned int decor = font_decoration_none;
+	if(!decoration)
+	{
+		return decor;
+	}
+	const char* p = decoration;
+	while(*p)
+	{
+		while(*p == ' ')
+		{
+			p++;
+		}
+		const char* token = p;
+		while(*p && *p != ' ')
+		{
+			p++;
+		}
+		size_t len = p - token;
+		if(len == 9 && !t_strncasecmp(token, "underline", len))
+		{
+			decor |= font_decoration_underline;
+		} else if(len == 12 && !t_strncasecmp(token, "line-through", len))
+		{
+			decor |= font_decoration_linethrough;
+		} else if(len == 8 && !t_strncasecmp(token, "overline", len))
+		{
+			decor |= font_decoration_overline;
+		}
+	}
+	return decor;
+}
+
+// FNV-1a of the name mixed with the other fields
+size_t litehtml::font_descriptor_hash::operator()(const font_descriptor& descr) const
+{
+	unsigned long long h = 14695981039346656037ull;
+	h ^= (unsigned long long) descr.size | (unsigned long long) descr.weight << 20 | (unsigned long long) descr.style << 40 | (unsigned long long) descr.decoration << 48;
+	h *= 1099511628211ull;
+	for(unsigned char c : descr.name)
+	{
+		h ^= c;
+		h *= 1099511628211ull;
+	}
+	return (size_t) h;
+}
+
+size_t litehtml::font_cache::key_hash::operator()(const key& k) const
+{
+	return font_descriptor_hash()(k.descr) ^ std::hash<document_container*>()(k.container);
+}
+
+litehtml::font_cache& litehtml::font_cache::instance()
+{
+	static font_cache cache;
+	return cache;
+}
+
+bool litehtml::font_cache::enabled() const
+{
+	lock_guard(m_mutex);
+	return m_enabled;
+}
+
+void litehtml::font_cache::set_enabled(bool enabled)
+{
+	lock_guard(m_mutex);
+	m_enabled = enabled;
+}
+
+// The first get() of a font reserves its entry and creates the font after unlocking, the other
+// get() calls of the font wait until it is created.
+litehtml::font_item litehtml::font_cache::get(document_container* container, const font_descriptor& descr)
+{
+	key k = {container, descr};
+	entry* ent;
+	{
+#ifndef LITEHTML_NO_THREADS
+		std::unique_lock<std::mutex> lock(m_mutex);
+#endif
+		auto iter = m_fonts.find(k);
+		if(iter != m_fonts.end())
+		{
+			m_stats.hits++;
+			ent = &iter->second;
+			if(!ent->refs++)
+			{
+				m_unused.erase(ent->unused);
+				ent->unused = m_unused.end();
+			}
+			update_statistics();
+#ifndef LITEHTML_NO_THREADS
+			// the entry is not removed while it has references
+			m_created.wait(lock, [ent] { return ent->created; });
+#endif
+			return ent->item;
+		}
+
+		m_stats.misses++;
+		ent = &m_fonts.emplace(std::move(k), entry{font_item(), 1, false, m_unused.end()}).first->second;
+		update_statistics();
+	}
+
+	font_item item = {0};
+	item.font = container->create_font(descr.name.c_str(), descr.size, descr.weight, descr.style, descr.decoration, &item.metrics);
+	{
+		lock_guard(m_mutex);
+		ent->item = item;
+		ent->created = true;
+	}
+#ifndef LITEHTML_NO_THREADS
+	m_created.notify_all();
+#endif
+	return item;
+}
+
+void litehtml::font_cache::release(document_container* container, const font_descriptor& descr)
+{
+	key k = {container, descr};
+	deleted_fonts deleted;
+	{
+		lock_guard(m_mutex);
+		auto iter = m_fonts.find(k);
+		if(iter == m_fonts.end() || iter->second.refs <= 0)
+		{
+			return;
+		}
+		if(!--iter->second.refs)
+		{
+			m_unused.push_front(&iter->first);
+			iter->second.unused = m_unused.begin();
+			evict(m_max_unused, deleted);
+		}
+		update_statistics();
+	}
+	delete_fonts(deleted);
+}
+
+void litehtml::font_cache::clear(document_container* container)
+{
+	deleted_fonts deleted;
+	{
+		lock_guard(m_mutex);
+		for(auto unused = m_unused.begin(); unused != m_unused.end();)
+		{
+			const key* k = *unused;
+			if(k->container == container)
+			{
+				auto iter = m_fonts.find(*k);
+				unused = m_unused.erase(unused);
+				deleted.emplace_back(container, iter->second.item.font);
+				m_fonts.erase(iter);
+			} else
+			{
+				unused++;
+			}
+		}
+		update_statistics();
+	}
+	delete_fonts(deleted);
+}
+
+size_t litehtml::font_cache::max_unused() const
+{
+	lock_guard(m_mutex);
+	return m_max_unused;
+}
+
+void litehtml::font_cache::set_max_unused(size_t max_unused)
+{
+	deleted_fonts deleted;
+	{
+		lock_guard(m_mutex);
+		m_max_unused = max_unused;
+		evict(max_unused, deleted);
+		update_statistics();
+	}
+	delete_fonts(deleted);
+}
+
+litehtml::font_cache::statistics litehtml::font_cache::get_statistics() const
+{
+	lock_guard(m_mutex);
+	return m_stats;
+}
+
+// removes the least recently used unused fonts until there are max_unused of them
+// the caller must hold the lock and delete the removed fonts after unlocking
+void litehtml::font_cache::evict(size_t max_unused, deleted_fonts& deleted)
+{
+	while(m_unused.size() > max_unused)
+	{
+		auto iter = m_fonts.find(*m_unused.back());
+		m_unused.pop_back();
+		deleted.emplace_back(iter->first.container, iter->second.item.font);
+		m_fonts.erase(iter);
+		m_stats.evictions++;
+	}
+}
+
+// the caller must hold the lock
+void litehtml::font_cache::update_statistics()
+{
+	m_stats.entries = (int) m_fonts.size();
+	m_stats.unused = (int) m_unused.size();
+}
+
+void litehtml::font_cache::delete_fonts(const deleted_fonts& deleted)
+{
+	for(const auto& font : deleted)
+	{
+		font.first->delete_font(font.second);
+	}
+}
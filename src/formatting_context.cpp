@@ -17,217 +17,104 @@ void litehtml::formatting_context::add_float(const std::shared_ptr<render_item>
 
 	if(fb.float_side == float_left)
 	{
-		if(m_floats_left.empty())
-		{
-			m_floats_left.push_back(fb);
-		} else
-		{
-			bool inserted = false;
-			for(auto i = m_floats_left.begin(); i != m_floats_left.end(); i++)
-			{
-				if(fb.pos.right() > i->pos.right())
-				{
-					m_floats_left.insert(i, std::move(fb));
-					inserted = true;
-					break;
-				}
-			}
-			if(!inserted)
-			{
-				m_floats_left.push_back(std::move(fb));
-			}
-		}
-		m_cache_line_left.invalidate();
+		index_float(fb);
+		m_floats_left.push_back(std::move(fb));
 	} else if(fb.float_side == float_right)
 	{
-		if(m_floats_right.empty())
-		{
-			m_floats_right.push_back(std::move(fb));
-		} else
-		{
-			bool inserted = false;
-			for(auto i = m_floats_right.begin(); i != m_floats_right.end(); i++)
-			{
-				if(fb.pos.left() < i->pos.left())
-				{
-					m_floats_right.insert(i, std::move(fb));
-					inserted = true;
-					break;
-				}
-			}
-			if(!inserted)
-			{
-				m_floats_right.push_back(fb);
-			}
-		}
-		m_cache_line_right.invalidate();
+		index_float(fb);
+		m_floats_right.push_back(std::move(fb));
 	}
 }
 
-int litehtml::formatting_context::get_floats_height(element_float el_float) const
+void litehtml::formatting_context::index_float(const floated_box& fb)
 {
-	int h = 0;
+	int top = fb.pos.top();
+	int bottom = fb.pos.bottom();
+	int min_width = fb.min_width;
 
-	for(const auto& fb : m_floats_left)
+	if(fb.float_side == float_left)
 	{
-		bool process = false;
-		switch(el_float)
-		{
-			case float_none:
-				process = true;
-				break;
-			case float_left:
-				if (fb.clear_floats == clear_left || fb.clear_floats == clear_both)
-				{
-					process = true;
-				}
-				break;
-			case float_right:
-				if (fb.clear_floats == clear_right || fb.clear_floats == clear_both)
-				{
-					process = true;
-				}
-				break;
-		}
-		if(process)
-		{
-			if(el_float == float_none)
-			{
-				h = std::max(h, fb.pos.bottom());
-			} else
-			{
-				h = std::max(h, fb.pos.top());
-			}
-		}
+		int right = fb.pos.right();
+		m_lines.update(top, bottom, [right](line_bounds& val) { val.left = std::max(val.left, right); });
+		m_min_left.emplace(fb.context, 0).first->second.update(top, bottom, [min_width](int& val) { val += min_width; });
+		m_left_bottom = std::max(m_left_bottom, bottom);
+	} else
+	{
+		int left = fb.pos.left();
+		m_lines.update(top, bottom, [left](line_bounds& val) { val.right = std::min(val.right, left); });
+		m_min_right.emplace(fb.context, 0).first->second.update(top, bottom, [min_width](int& val) { val += min_width; });
+		m_right_bottom = std::max(m_right_bottom, bottom);
 	}
 
-
-	for(const auto& fb : m_floats_right)
+	if(fb.clear_floats == clear_left || fb.clear_floats == clear_both)
 	{
-		int process = false;
-		switch(el_float)
-		{
-			case float_none:
-				process = true;
-				break;
-			case float_left:
-				if (fb.clear_floats == clear_left || fb.clear_floats == clear_both)
-				{
-					process = true;
-				}
-				break;
-			case float_right:
-				if (fb.clear_floats == clear_right || fb.clear_floats == clear_both)
-				{
-					process = true;
-				}
-				break;
-		}
-		if(process)
-		{
-			if(el_float == float_none)
-			{
-				h = std::max(h, fb.pos.bottom());
-			} else
-			{
-				h = std::max(h, fb.pos.top());
-			}
-		}
+		m_clear_left_top = std::max(m_clear_left_top, top);
+	}
+	if(fb.clear_floats == clear_right || fb.clear_floats == clear_both)
+	{
+		m_clear_right_top = std::max(m_clear_right_top, top);
 	}
-
-	return h - m_current_top;
 }
 
-int litehtml::formatting_context::get_left_floats_height() const
+// rebuilds the indexes after the floats were removed or moved
+void litehtml::formatting_context::reindex_floats()
 {
-	int h = 0;
-	if(!m_floats_left.empty())
+	m_lines.clear();
+	m_min_left.clear();
+	m_min_right.clear();
+	m_left_bottom		= 0;
+	m_right_bottom		= 0;
+	m_clear_left_top	= 0;
+	m_clear_right_top	= 0;
+
+	for(const auto& fb : m_floats_left)
 	{
-		for (const auto& fb : m_floats_left)
-		{
-			h = std::max(h, fb.pos.bottom());
-		}
+		index_float(fb);
+	}
+	for(const auto& fb : m_floats_right)
+	{
+		index_float(fb);
 	}
-	return h - m_current_top;
 }
 
-int litehtml::formatting_context::get_right_floats_height() const
+int litehtml::formatting_context::get_floats_height(element_float el_float) const
 {
 	int h = 0;
-	if(!m_floats_right.empty())
+	switch(el_float)
 	{
-		for(const auto& fb : m_floats_right)
-		{
-			h = std::max(h, fb.pos.bottom());
-		}
+		case float_none:
+			h = std::max(m_left_bottom, m_right_bottom);
+			break;
+		case float_left:
+			h = m_clear_left_top;
+			break;
+		case float_right:
+			h = m_clear_right_top;
+			break;
 	}
 	return h - m_current_top;
 }
 
-int litehtml::formatting_context::get_line_left(int y )
+int litehtml::formatting_context::get_left_floats_height() const
 {
-	y += m_current_top;
+	return m_left_bottom - m_current_top;
+}
 
-	if(m_cache_line_left.is_valid && m_cache_line_left.hash == y)
-	{
-		if(m_cache_line_left.val - m_current_left < 0)
-		{
-			return 0;
-		}
-		return m_cache_line_left.val - m_current_left;
-	}
+int litehtml::formatting_context::get_right_floats_height() const
+{
+	return m_right_bottom - m_current_top;
+}
 
-	int w = 0;
-	for(const auto& fb : m_floats_left)
-	{
-		if (y >= fb.pos.top() && y < fb.pos.bottom())
-		{
-			w = std::max(w, fb.pos.right());
-			if (w < fb.pos.right())
-			{
-				break;
-			}
-		}
-	}
-	m_cache_line_left.set_value(y, w);
-	w -= m_current_left;
+int litehtml::formatting_context::get_line_left(int y )
+{
+	int w = m_lines.get(y + m_current_top).left - m_current_left;
 	if(w < 0) return 0;
 	return w;
 }
 
 int litehtml::formatting_context::get_line_right(int y, int def_right )
 {
-	y += m_current_top;
-	def_right += m_current_left;
-	if(m_cache_line_right.is_valid && m_cache_line_right.hash == y)
-	{
-		if(m_cache_line_right.is_default)
-		{
-			return def_right - m_current_left;
-		} else
-		{
-			int w = std::min(m_cache_line_right.val, def_right) - m_current_left;
-			if(w < 0) return 0;
-			return w;
-		}
-	}
-
-	int w = def_right;
-	m_cache_line_right.is_default = true;
-	for(const auto& fb : m_floats_right)
-	{
-		if(y >= fb.pos.top() && y < fb.pos.bottom())
-		{
-			w = std::min(w, fb.pos.left());
-			m_cache_line_right.is_default = false;
-			if(w > fb.pos.left())
-			{
-				break;
-			}
-		}
-	}
-	m_cache_line_right.set_value(y, w);
-	w -= m_current_left;
+	int w = std::min(m_lines.get(y + m_current_top).right, def_right + m_current_left) - m_current_left;
 	if(w < 0) return 0;
 	return w;
 }
@@ -235,13 +122,14 @@ int litehtml::formatting_context::get_line_right(int y, int def_right )
 
 void litehtml::formatting_context::clear_floats(int context)
 {
+	bool removed = false;
 	auto iter = m_floats_left.begin();
 	while(iter != m_floats_left.end())
 	{
 		if(iter->context >= context)
 		{
 			iter = m_floats_left.erase(iter);
-			m_cache_line_left.invalidate();
+			removed = true;
 		} else
 		{
 			iter++;
@@ -254,12 +142,17 @@ void litehtml::formatting_context::clear_floats(int context)
 		if(iter->context >= context)
 		{
 			iter = m_floats_right.erase(iter);
-			m_cache_line_right.invalidate();
+			removed = true;
 		} else
 		{
 			iter++;
 		}
 	}
+
+	if(removed)
+	{
+		reindex_floats();
+	}
 }
 
 int litehtml::formatting_context::get_cleared_top(const std::shared_ptr<render_item> &el, int line_top) const
@@ -313,58 +206,22 @@ int litehtml::formatting_context::find_next_line_top(int top, int width, int def
 	def_right += m_current_left;
 
 	int new_top = top;
-	int_vector points;
-
-	for(const auto& fb : m_floats_left)
-	{
-		if(fb.pos.top() >= top)
-		{
-			if(find(points.begin(), points.end(), fb.pos.top()) == points.end())
-			{
-				points.push_back(fb.pos.top());
-			}
-		}
-		if (fb.pos.bottom() >= top)
-		{
-			if (find(points.begin(), points.end(), fb.pos.bottom()) == points.end())
-			{
-				points.push_back(fb.pos.bottom());
-			}
-		}
-	}
-
-	for (const auto& fb : m_floats_right)
-	{
-		if (fb.pos.top() >= top)
-		{
-			if (find(points.begin(), points.end(), fb.pos.top()) == points.end())
-			{
-				points.push_back(fb.pos.top());
-			}
-		}
-		if (fb.pos.bottom() >= top)
-		{
-			if (find(points.begin(), points.end(), fb.pos.bottom()) == points.end())
-			{
-				points.push_back(fb.pos.bottom());
-			}
-		}
-	}
 
-	if(!points.empty())
+	// the line bounds change at the float edges only, so the edges below top are the candidates
+	const auto& steps = m_lines.steps();
+	auto iter = steps.lower_bound(top);
+	if(iter != steps.end())
 	{
-		sort(points.begin(), points.end(), std::less<int>( ));
-		new_top = points.back();
+		new_top = steps.rbegin()->first;
 
-		for(auto pt : points)
+		for(; iter != steps.end(); iter++)
 		{
-			int pos_left	= 0;
-			int pos_right	= def_right;
-			get_line_left_right(pt - m_current_top, def_right - m_current_left, pos_left, pos_right);
+			int pos_left	= std::max(iter->second.left - m_current_left, 0);
+			int pos_right	= std::max(std::min(iter->second.right, def_right) - m_current_left, 0);
 
 			if(pos_right - pos_left >= width)
 			{
-				new_top = pt;
+				new_top = iter->first;
 				break;
 			}
 		}
@@ -374,31 +231,26 @@ int litehtml::formatting_context::find_next_line_top(int top, int width, int def
 
 void litehtml::formatting_context::update_floats(int dy, const std::shared_ptr<render_item> &parent)
 {
-	bool reset_cache = false;
-	for(auto fb = m_floats_left.rbegin(); fb != m_floats_left.rend(); fb++)
+	bool moved = false;
+	for(auto& fb : m_floats_left)
 	{
-		if(fb->el->src_el()->is_ancestor(parent->src_el()))
+		if(fb.el->src_el()->is_ancestor(parent->src_el()))
 		{
-			reset_cache	= true;
-			fb->pos.y	+= dy;
+			moved	= true;
+			fb.pos.y	+= dy;
 		}
 	}
-	if(reset_cache)
-	{
-		m_cache_line_left.invalidate();
-	}
-	reset_cache = false;
-	for(auto fb = m_floats_right.rbegin(); fb != m_floats_right.rend(); fb++)
+	for(auto& fb : m_floats_right)
 	{
-		if(fb->el->src_el()->is_ancestor(parent->src_el()))
+		if(fb.el->src_el()->is_ancestor(parent->src_el()))
 		{
-			reset_cache	= true;
-			fb->pos.y	+= dy;
+			moved	= true;
+			fb.pos.y	+= dy;
 		}
 	}
-	if(reset_cache)
+	if(moved)
 	{
-		m_cache_line_right.invalidate();
+		reindex_floats();
 	}
 }
 
@@ -412,14 +264,11 @@ void litehtml::formatting_context::apply_relative_shift(const containing_block_c
 
 int litehtml::formatting_context::find_min_left(int y, int context_idx)
 {
-	y += m_current_top;
 	int min_left = m_current_left;
-	for(const auto& fb : m_floats_left)
+	auto iter = m_min_left.find(context_idx);
+	if(iter != m_min_left.end())
 	{
-		if (y >= fb.pos.top() && y < fb.pos.bottom() && fb.context == context_idx)
-		{
-			min_left += fb.min_width;
-		}
+		min_left += iter->second.get(y + m_current_top);
 	}
 	if(min_left < m_current_left) return 0;
 	return min_left - m_current_left;
@@ -427,14 +276,11 @@ int litehtml::formatting_context::find_min_left(int y, int context_idx)
 
 int litehtml::formatting_context::find_min_right(int y, int right, int context_idx)
 {
-	y += m_current_top;
 	int min_right = right + m_current_left;
-	for(const auto& fb : m_floats_right)
+	auto iter = m_min_right.find(context_idx);
+	if(iter != m_min_right.end())
 	{
-		if (y >= fb.pos.top() && y < fb.pos.bottom() && fb.context == context_idx)
-		{
-			min_right -= fb.min_width;
-		}
+		min_right -= iter->second.get(y + m_current_top);
 	}
 	if(min_right < m_current_left) return 0;
 	return min_right - m_current_left;
@@ -89,32 +89,58 @@ void litehtml::html_tag::set_attr( const char* _name, const char* _val )
 	{
 		string name = _name;
 		lcase(name);
-		m_attrs[name] = _val;
+		set_attr(_id(name), string(_val));
+	}
+}
 
-		if( name == "class" )
-		{
-			string val = _val;
-			// class names are matched case-insensitively in quirks mode
-			// we match them case-insensitively in all modes (same for id)
-			lcase(val);
-			m_str_classes.resize( 0 );
-			split_string( val, m_str_classes, " " );
-			m_classes.clear();
-			for (auto& cls : m_str_classes) m_classes.push_back(_id(cls));
-		}
-		else if (name == "id")
+void litehtml::html_tag::set_attr(string_id name, string&& val)
+{
+	if( name == _class_ )
+	{
+		// class names are matched case-insensitively in quirks mode
+		// we match them case-insensitively in all modes (same for id)
+		string cls = val;
+		lcase(cls);
+		m_str_classes.resize( 0 );
+		split_string( cls, m_str_classes, " " );
+		m_classes.clear();
+		for (auto& str : m_str_classes) m_classes.push_back(_id(str));
+	}
+	else if( name == _id_ )
+	{
+		string id = val;
+		lcase(id);
+		m_id = _id(id);
+	}
+
+	auto attr = std::lower_bound(m_attrs.begin(), m_attrs.end(), name,
+		[](const attr_map::value_type& a, string_id b) { return a.first < b; });
+	if(attr != m_attrs.end() && attr->first == name)
+	{
+		attr->second = std::move(val);
+	} else
+	{
+		m_attrs.emplace(attr, name, std::move(val));
+	}
+}
+
+const char* litehtml::html_tag::get_attr( const char* name, const char* def ) const
+{
+	for(const auto& attr : m_attrs)
+	{
+		if(_s(attr.first) == name)
 		{
-			string val = _val;
-			lcase(val);
-			m_id = _id(val);
+			return attr.second.c_str();
 		}
 	}
+	return def;
 }
 
-const char* litehtml::html_tag::get_attr( const char* name, const char* def ) const
+const char* litehtml::html_tag::get_attr(string_id name, const char* def) const
 {
-	auto attr = m_attrs.find(name);
-	if(attr != m_attrs.end())
+	auto attr = std::lower_bound(m_attrs.begin(), m_attrs.end(), name,
+		[](const attr_map::value_type& a, string_id b) { return a.first < b; });
+	if(attr != m_attrs.end() && attr->first == name)
 	{
 		return attr->second.c_str();
 	}
@@ -178,26 +204,18 @@ litehtml::element::ptr litehtml::html_tag::select_one( const css_selector& selec
 
 void litehtml::html_tag::apply_stylesheet( const litehtml::css& stylesheet )
 {
-	if(is_root())
-	{
-		int i = 0;
-		i++;
-	}
-	for(const auto& sel : stylesheet.selectors())
+	ancestor_filter& filter = get_document()->get_ancestor_filter();
+	bool seeded = seed_ancestor_filter(filter, true);
+
+	// only the rules that can match this element by their rightmost id/class/tag
+	css_selector::vector candidates;
+	stylesheet.get_candidate_selectors(m_tag, m_id, m_classes, candidates);
+
+	for(const auto& sel : candidates)
 	{
-		// optimization
+		if(!filter.may_match(*sel))
 		{
-			const auto& r = sel->m_right;
-			if (r.m_tag != star_id && r.m_tag != m_tag)
-				continue;
-
-			if (!r.m_attrs.empty())
-			{
-				const auto& attr = r.m_attrs[0];
-				if (attr.type == select_class &&
-					std::find(m_classes.begin(), m_classes.end(), attr.name) == m_classes.end())
-					continue;
-			}
+			continue;
 		}
 
 		int apply = select(*sel, false);
@@ -271,6 +289,7 @@ void litehtml::html_tag::apply_stylesheet( const litehtml::css& stylesheet )
 		}
 	}
 
+	update_ancestor_filter(filter, true);
 	for(auto& el : m_children)
 	{
 		if(el->css().get_display() != display_inline_text)
@@ -278,6 +297,38 @@ void litehtml::html_tag::apply_stylesheet( const litehtml::css& stylesheet )
 			el->apply_stylesheet(stylesheet);
 		}
 	}
+	update_ancestor_filter(filter, false);
+
+	if(seeded)
+	{
+		seed_ancestor_filter(filter, false);
+	}
+}
+
+void litehtml::html_tag::update_ancestor_filter(ancestor_filter& filter, bool add) const
+{
+	if(add)
+	{
+		filter.push_element(m_tag, m_id, m_classes);
+	} else
+	{
+		filter.pop_element(m_tag, m_id, m_classes);
+	}
+}
+
+// The ancestor filter is filled by the tree walk. If the walk starts in the middle of the
+// tree (append_children_from_string, hover changes) the parents must be added first.
+bool litehtml::html_tag::seed_ancestor_filter(ancestor_filter& filter, bool add) const
+{
+	if(add && filter.depth() != 0)
+	{
+		return false;
+	}
+	for(element::ptr el = parent(); el; el = el->parent())
+	{
+		el->update_ancestor_filter(filter, add);
+	}
+	return true;
 }
 
 void litehtml::html_tag::get_content_size( size& sz, int max_width )
@@ -419,7 +470,24 @@ void litehtml::html_tag::compute_styles(bool recursive)
 
 	m_style.subst_vars(this);
 
-	m_css.compute(this, doc);
+	// siblings with the same tag, attributes and matched rules have the same computed style
+	std::shared_ptr<html_tag> sibling;
+	bool shareable = m_tag != empty_id && m_tag != __tag_before_ && m_tag != __tag_after_ && !is_root();
+	if(shareable)
+	{
+		sibling = doc->get_style_sharing_cache().find(*this);
+	}
+	if(sibling)
+	{
+		m_css = sibling->m_css;
+	} else
+	{
+		m_css.compute(this, doc);
+		if(shareable)
+		{
+			doc->get_style_sharing_cache().add(std::static_pointer_cast<html_tag>(shared_from_this()));
+		}
+	}
 
 	if (recursive)
 	{
@@ -430,6 +498,33 @@ void litehtml::html_tag::compute_styles(bool recursive)
 	}
 }
 
+bool litehtml::html_tag::can_share_style(const html_tag& sibling) const
+{
+	if(&sibling == this || sibling.m_tag != m_tag || sibling.m_id != m_id || sibling.m_classes != m_classes)
+	{
+		return false;
+	}
+	// the same parent gives the same inherited values
+	if(sibling.m_parent.owner_before(m_parent) || m_parent.owner_before(sibling.m_parent))
+	{
+		return false;
+	}
+	// the attributes cover the inline style and the presentational hints
+	if(sibling.m_attrs != m_attrs || sibling.m_used_styles.size() != m_used_styles.size())
+	{
+		return false;
+	}
+	for(size_t i = 0; i < m_used_styles.size(); i++)
+	{
+		if(m_used_styles[i]->m_selector != sibling.m_used_styles[i]->m_selector ||
+			m_used_styles[i]->m_used != sibling.m_used_styles[i]->m_used)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 bool litehtml::html_tag::is_white_space() const
 {
 	return false;
@@ -702,7 +797,7 @@ int litehtml::html_tag::select_pseudoclass(const css_attribute_selector& sel)
 
 int litehtml::html_tag::select_attribute(const css_attribute_selector& sel)
 {
-	const char* attr_value = get_attr(_s(sel.name).c_str());
+	const char* attr_value = get_attr(sel.name);
 
 	switch (sel.type)
 	{
@@ -903,6 +998,7 @@ void litehtml::html_tag::draw_background(uint_ptr hdc, int x, int y, const posit
 
 	position el_pos = pos;
 	el_pos += ri->get_paddings();
+	el_pos += ri->get_borders();
 	el_pos += ri->get_margins();
 
 	if(m_css.get_display() != display_inline && m_css.get_display() != display_table_row)
@@ -1275,7 +1371,7 @@ void litehtml::html_tag::draw_list_marker( uint_ptr hdc, const position& pos )
 		{
 			if(lm.font)
 			{
-				auto tw_space = get_document()->container()->text_width(" ", lm.font);
+				auto tw_space = get_document()->text_width(" ", lm.font);
 				lm.pos.x = pos.x - tw_space * 2;
 				lm.pos.width = tw_space;
 			} else
@@ -1302,7 +1398,7 @@ void litehtml::html_tag::draw_list_marker( uint_ptr hdc, const position& pos )
 			if(lm.font)
 			{
 				marker_text += ".";
-				auto tw = get_document()->container()->text_width(marker_text.c_str(), lm.font);
+				auto tw = get_document()->text_width(marker_text.c_str(), lm.font);
 				auto text_pos = lm.pos;
 				text_pos.move_to(text_pos.right() - tw, text_pos.y);
 				text_pos.width = tw;
@@ -1579,6 +1675,10 @@ void litehtml::html_tag::add_style(const style& style)
 
 void litehtml::html_tag::refresh_styles()
 {
+	ancestor_filter& filter = get_document()->get_ancestor_filter();
+	bool seeded = seed_ancestor_filter(filter, true);
+
+	update_ancestor_filter(filter, true);
 	for (auto& el : m_children)
 	{
 		if(el->css().get_display() != display_inline_text)
@@ -1586,6 +1686,7 @@ void litehtml::html_tag::refresh_styles()
 			el->refresh_styles();
 		}
 	}
+	update_ancestor_filter(filter, false);
 
 	m_style.clear();
 
@@ -1593,7 +1694,7 @@ void litehtml::html_tag::refresh_styles()
 	{
 		usel->m_used = false;
 
-		if(usel->m_selector->is_media_valid())
+		if(usel->m_selector->is_media_valid() && filter.may_match(*usel->m_selector))
 		{
 			int apply = select(*usel->m_selector, false);
 
@@ -1646,6 +1747,11 @@ void litehtml::html_tag::refresh_styles()
 			}
 		}
 	}
+
+	if(seeded)
+	{
+		seed_ancestor_filter(filter, false);
+	}
 }
 
 const litehtml::background* litehtml::html_tag::get_background(bool own_only)
@@ -2,6 +2,7 @@
 #include "line_box.h"
 #include "element.h"
 #include "render_item.h"
+#include "render_text.h"
 #include <algorithm>
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +24,11 @@ int litehtml::line_box_item::width() const
 	return m_element->width();
 }
 
+int litehtml::line_box_item::height() const
+{
+	return m_element->height();
+}
+
 int litehtml::line_box_item::top() const
 {
 	return m_element->top();
@@ -43,6 +49,118 @@ int litehtml::line_box_item::left() const
 	return m_element->left();
 }
 
+bool litehtml::line_box_item::is_white_space() const
+{
+	return m_element->src_el()->is_white_space();
+}
+
+bool litehtml::line_box_item::is_break() const
+{
+	return m_element->src_el()->is_break();
+}
+
+bool litehtml::line_box_item::is_space() const
+{
+	return m_element->src_el()->is_space();
+}
+
+bool litehtml::line_box_item::skip() const
+{
+	return m_element->skip();
+}
+
+void litehtml::line_box_item::skip(bool val)
+{
+	m_element->skip(val);
+}
+
+void litehtml::line_box_item::apply_relative_shift(const containing_block_context &containing_block_size)
+{
+	m_element->apply_relative_shift(containing_block_size);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+static inline litehtml::render_item_text& text_run(const std::shared_ptr<litehtml::render_item>& el)
+{
+	return static_cast<litehtml::render_item_text&>(*el);
+}
+
+litehtml::lbi_text::lbi_text(const std::shared_ptr<render_item>& element, int index) : line_box_item(element), m_index(index)
+{
+}
+
+litehtml::position& litehtml::lbi_text::pos()
+{
+	return text_run(m_element).box(m_index);
+}
+
+void litehtml::lbi_text::place_to(int x, int y)
+{
+	pos().x = x;
+	pos().y = y;
+}
+
+int litehtml::lbi_text::width() const
+{
+	return text_run(m_element).box(m_index).width;
+}
+
+int litehtml::lbi_text::height() const
+{
+	return text_run(m_element).box(m_index).height;
+}
+
+int litehtml::lbi_text::top() const
+{
+	return text_run(m_element).box(m_index).top();
+}
+
+int litehtml::lbi_text::bottom() const
+{
+	return text_run(m_element).box(m_index).bottom();
+}
+
+int litehtml::lbi_text::right() const
+{
+	return text_run(m_element).box(m_index).right();
+}
+
+int litehtml::lbi_text::left() const
+{
+	return text_run(m_element).box(m_index).left();
+}
+
+bool litehtml::lbi_text::is_white_space() const
+{
+	return text_run(m_element).text().is_segment_white_space(m_index);
+}
+
+bool litehtml::lbi_text::is_break() const
+{
+	return text_run(m_element).text().is_segment_break(m_index);
+}
+
+bool litehtml::lbi_text::is_space() const
+{
+	return text_run(m_element).text().is_segment_space(m_index);
+}
+
+bool litehtml::lbi_text::skip() const
+{
+	return text_run(m_element).is_box_skipped(m_index);
+}
+
+void litehtml::lbi_text::skip(bool val)
+{
+	text_run(m_element).skip_box(m_index, val);
+}
+
+void litehtml::lbi_text::apply_relative_shift(const containing_block_context &containing_block_size)
+{
+	m_element->apply_relative_shift(containing_block_size, pos());
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 
 litehtml::lbi_start::lbi_start(const std::shared_ptr<render_item>& element) : line_box_item(element)
@@ -139,12 +257,12 @@ int litehtml::lbi_continue::width() const
 
 void litehtml::line_box::add_item(std::unique_ptr<line_box_item> item)
 {
-    item->get_el()->skip(false);
+    item->skip(false);
     bool add	= true;
 	switch (item->get_type())
 	{
 		case line_box_item::type_text_part:
-			if(item->get_el()->src_el()->is_white_space())
+			if(item->is_white_space())
 			{
 				add = !is_empty() && !have_last_space();
 			}
@@ -159,11 +277,11 @@ void litehtml::line_box::add_item(std::unique_ptr<line_box_item> item)
 	{
 		item->place_to(m_left + m_width, m_top);
 		m_width += item->width();
-		m_height = std::max(m_height, item->get_el()->height());
+		m_height = std::max(m_height, item->height());
 		m_items.emplace_back(std::move(item));
 	} else
 	{
-		item->get_el()->skip(true);
+		item->skip(true);
 	}
 }
 
@@ -191,9 +309,9 @@ int litehtml::line_box::calc_va_baseline(const va_context& current, vertical_ali
 	}
 }
 
-std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::finish(bool last_box, const containing_block_context &containing_block_size)
+litehtml::line_box_item::vector litehtml::line_box::finish(bool last_box, const containing_block_context &containing_block_size)
 {
-	std::list< std::unique_ptr<line_box_item> > ret_items;
+	line_box_item::vector ret_items;
 
 	if(!last_box)
 	{
@@ -202,11 +320,11 @@ std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::finish
 			if (m_items.back()->get_type() == line_box_item::type_text_part)
 			{
 				// remove trailing spaces
-				if (m_items.back()->get_el()->src_el()->is_break() ||
-					m_items.back()->get_el()->src_el()->is_white_space())
+				if (m_items.back()->is_break() ||
+					m_items.back()->is_white_space())
 				{
 					m_width -= m_items.back()->width();
-					m_items.back()->get_el()->skip(true);
+					m_items.back()->skip(true);
 					m_items.pop_back();
 				} else
 				{
@@ -232,9 +350,9 @@ std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::finish
 		{
 			if ((*iter)->get_type() == line_box_item::type_text_part)
 			{
-				if((*iter)->get_el()->src_el()->is_white_space())
+				if((*iter)->is_white_space())
 				{
-					(*iter)->get_el()->skip(true);
+					(*iter)->skip(true);
 					m_width -= (*iter)->width();
 					// Space can be between text and inline_end marker
 					// We have to shift all items on the right side
@@ -310,7 +428,7 @@ std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::finish
     int line_bottom	= 0;
 
 	va_context current_context;
-	std::list<va_context> contexts;
+	std::vector<va_context> contexts;
 
 	current_context.baseline = 0;
 	current_context.fm = m_font_metrics;
@@ -429,7 +547,7 @@ std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::finish
 		explicit inline_item_box(const std::shared_ptr<render_item>& el) : element(el) {}
 	};
 
-	std::list<inline_item_box> inlines;
+	std::vector<inline_item_box> inlines;
 
 	contexts.clear();
 
@@ -488,7 +606,7 @@ std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::finish
 				lbi->pos().y = m_top + m_height - lbi->get_el()->height() + lbi->get_el()->content_offset_top();
 			}
         }
-        lbi->get_el()->apply_relative_shift(containing_block_size);
+        lbi->apply_relative_shift(containing_block_size);
 
 		// Calculate and push inline box into the render item element
 		if(lbi->get_type() == line_box_item::type_inline_start || lbi->get_type() == line_box_item::type_inline_continue)
@@ -517,32 +635,32 @@ std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::finish
 		iter->box.width =  m_items.back()->right() - iter->box.x;
 		iter->element->add_inline_box(iter->box);
 
-		ret_items.emplace_front(std::unique_ptr<line_box_item>(new lbi_continue(iter->element)));
+		ret_items.emplace(ret_items.begin(), std::unique_ptr<line_box_item>(new lbi_continue(iter->element)));
 	}
 
 	return std::move(ret_items);
 }
 
-std::shared_ptr<litehtml::render_item> litehtml::line_box::get_first_text_part() const
+const litehtml::line_box_item* litehtml::line_box::get_first_text_part() const
 {
 	for(const auto & item : m_items)
 	{
 		if(item->get_type() == line_box_item::type_text_part)
 		{
-			return item->get_el();
+			return item.get();
 		}
 	}
 	return nullptr;
 }
 
 
-std::shared_ptr<litehtml::render_item> litehtml::line_box::get_last_text_part() const
+const litehtml::line_box_item* litehtml::line_box::get_last_text_part() const
 {
 	for(auto iter = m_items.rbegin(); iter != m_items.rend(); iter++)
 	{
 		if((*iter)->get_type() == line_box_item::type_text_part)
 		{
-			return (*iter)->get_el();
+			return iter->get();
 		}
 	}
 	return nullptr;
@@ -558,19 +676,19 @@ bool litehtml::line_box::can_hold(const std::unique_ptr<line_box_item>& item, wh
 		auto last_el = get_last_text_part();
 
 		// force new line if the last placed element was line break
-		if (last_el && last_el->src_el()->is_break())
+		if (last_el && last_el->is_break())
 		{
 			return false;
 		}
 
 		// line break should stay in current line box
-		if (item->get_el()->src_el()->is_break())
+		if (item->is_break())
 		{
 			return true;
 		}
 
 		if (ws == white_space_nowrap || ws == white_space_pre ||
-			(ws == white_space_pre_wrap && item->get_el()->src_el()->is_space()))
+			(ws == white_space_pre_wrap && item->is_space()))
 		{
 			return true;
 		}
@@ -589,7 +707,7 @@ bool litehtml::line_box::have_last_space()  const
 	auto last_el = get_last_text_part();
 	if(last_el)
 	{
-		return last_el->src_el()->is_white_space() || last_el->src_el()->is_break();
+		return last_el->is_white_space() || last_el->is_break();
 	}
 	return false;
 }
@@ -601,7 +719,7 @@ bool litehtml::line_box::is_empty() const
     {
 		if(el->get_type() == line_box_item::type_text_part)
 		{
-			if (!el->get_el()->skip() || el->get_el()->src_el()->is_break())
+			if (!el->skip() || el->is_break())
 			{
 				return false;
 			}
@@ -644,10 +762,10 @@ bool litehtml::line_box::is_break_only() const
 	{
 		if((*iter)->get_type() == line_box_item::type_text_part)
 		{
-			if((*iter)->get_el()->src_el()->is_break())
+			if((*iter)->is_break())
 			{
 				break_found = true;
-			} else if(!(*iter)->get_el()->skip())
+			} else if(!(*iter)->skip())
 			{
 				return false;
 			}
@@ -656,9 +774,9 @@ bool litehtml::line_box::is_break_only() const
 	return break_found;
 }
 
-std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::new_width( int left, int right)
+litehtml::line_box_item::vector litehtml::line_box::new_width( int left, int right)
 {
-	std::list< std::unique_ptr<line_box_item> > ret_items;
+	line_box_item::vector ret_items;
     int add = left - m_left;
     if(add)
     {
@@ -670,7 +788,7 @@ std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::new_wi
 		i++;
 		while (i != m_items.end())
         {
-            if(!(*i)->get_el()->skip())
+            if(!(*i)->skip())
             {
                 if(m_left + m_width + (*i)->width() > m_right)
                 {
@@ -679,17 +797,14 @@ std::list< std::unique_ptr<litehtml::line_box_item> > litehtml::line_box::new_wi
                 } else
                 {
 					(*i)->pos().x += add;
-                    m_width += (*i)->get_el()->width();
+                    m_width += (*i)->width();
                 }
             }
 			i++;
         }
         if(remove_begin != m_items.end())
         {
-			while(remove_begin != m_items.end())
-			{
-				ret_items.emplace_back(std::move(*remove_begin));
-			}
+			ret_items.insert(ret_items.end(), std::make_move_iterator(remove_begin), std::make_move_iterator(m_items.end()));
             m_items.erase(remove_begin, m_items.end());
         }
     }
@@ -0,0 +1,81 @@
+#include "html.h"
+#include "object_pool.h"
+#include <new>
+
+#ifndef LITEHTML_NO_THREADS
+	#define LITEHTML_THREAD_LOCAL thread_local
+#else
+	#define LITEHTML_THREAD_LOCAL
+#endif
+
+namespace
+{
+	struct free_block
+	{
+		free_block* next;
+	};
+
+	const size_t lists_count = litehtml::object_pool::max_object_size / litehtml::object_pool::granularity;
+
+	// trivially destructible, so the objects destroyed after the release of the thread lists
+	// (e.g. documents in static variables) still can check t_released
+	LITEHTML_THREAD_LOCAL free_block*	t_free_lists[lists_count];
+	LITEHTML_THREAD_LOCAL bool			t_released = false;
+
+	// returns the free blocks of the thread to the global allocator when the thread exits
+	struct free_lists_release
+	{
+		~free_lists_release()
+		{
+			for(auto& list : t_free_lists)
+			{
+				while(list)
+				{
+					free_block* next = list->next;
+					::operator delete(list);
+					list = next;
+				}
+			}
+			t_released = true;
+		}
+	};
+
+	size_t list_index(size_t size)
+	{
+		return size ? (size - 1) / litehtml::object_pool::granularity : 0;
+	}
+}
+
+void* litehtml::object_pool::allocate(size_t size)
+{
+	if(size <= max_object_size)
+	{
+		free_block*& list = t_free_lists[list_index(size)];
+		if(list)
+		{
+			free_block* block = list;
+			list = block->next;
+			return block;
+		}
+		// the blocks of one list serve all the sizes of the list
+		return ::operator new((list_index(size) + 1) * granularity);
+	}
+	return ::operator new(size);
+}
+
+void litehtml::object_pool::deallocate(void* ptr, size_t size)
+{
+	if(!ptr) return;
+	if(size <= max_object_size && !t_released)
+	{
+		static LITEHTML_THREAD_LOCAL free_lists_release release;
+		(void) release;
+
+		free_block* block = (free_block*) ptr;
+		free_block*& list = t_free_lists[list_index(size)];
+		block->next = list;
+		list = block;
+		return;
+	}
+	::operator delete(ptr);
+}
@@ -251,6 +251,8 @@ int litehtml::render_item_block::_render(int x, int y, const containing_block_co
 		}
 
 		_render_content(x, y, true, self_size.new_width(m_pos.width), fmt_ctx);
+		// a second pass render would keep the content laid out for the original width
+		m_layout_cache.second_pass = true;
 	}
 
 	// Set block height
@@ -7,7 +7,7 @@ int litehtml::render_item_flex::_render_content(int x, int y, bool second_pass,
     return 0;
 }
 
-void litehtml::render_item_flex::draw_children(uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex)
+void litehtml::render_item_flex::add_paint_ops(paint_list& list, int x, int y, draw_flag flag, int zindex)
 {
 
 }
@@ -2,10 +2,12 @@
 #include "render_inline_context.h"
 #include "document.h"
 #include "iterators.h"
+#include "render_text.h"
 
 int litehtml::render_item_inline_context::_render_content(int x, int y, bool second_pass, const containing_block_context &self_size, formatting_context* fmt_ctx)
 {
     m_line_boxes.clear();
+	m_text_runs.clear();
 	m_max_line_width = 0;
 
     white_space ws = src_el()->css().get_white_space();
@@ -29,24 +31,37 @@ int litehtml::render_item_inline_context::_render_content(int x, int y, bool sec
 			{
 				case iterator_item_type_child:
 					{
-						// skip spaces to make rendering a bit faster
-						if (skip_spaces)
+						if (el->src_el()->is_text())
 						{
-							if (el->src_el()->is_white_space())
+							// the segments of a text run are placed one by one
+							auto run = std::static_pointer_cast<render_item_text>(el);
+							run->reset_boxes();
+							m_text_runs.push_back(run);
+							for (int i = 0; i < run->boxes_count(); i++)
 							{
-								if (was_space)
-								{
-									el->skip(true);
-									return;
-								} else
+								// skip spaces to make rendering a bit faster
+								if (skip_spaces)
 								{
-									was_space = true;
+									if (run->text().is_segment_white_space(i))
+									{
+										if (was_space)
+										{
+											continue;
+										}
+										was_space = true;
+									} else
+									{
+										// skip all spaces after line break
+										was_space = run->text().is_segment_break(i);
+									}
 								}
-							} else
-							{
-								// skip all spaces after line break
-								was_space = el->src_el()->is_break();
+								place_inline(std::unique_ptr<line_box_item>(new lbi_text(el, i)), self_size, fmt_ctx);
 							}
+							return;
+						}
+						if (skip_spaces)
+						{
+							was_space = el->src_el()->is_break();
 						}
 						// place element into rendering flow
 						place_inline(std::unique_ptr<line_box_item>(new line_box_item(el)), self_size, fmt_ctx);
@@ -69,6 +84,7 @@ int litehtml::render_item_inline_context::_render_content(int x, int y, bool sec
         });
 
     finish_last_box(true, self_size);
+	update_text_runs();
 
     if (!m_line_boxes.empty())
     {
@@ -105,15 +121,15 @@ void litehtml::render_item_inline_context::fix_line_width(element_float flt,
 
         std::vector<std::shared_ptr<render_item>> els;
         bool was_cleared = false;
-        if(el_front && el_front->src_el()->css().get_clear() != clear_none)
+        if(el_front && el_front->get_el()->src_el()->css().get_clear() != clear_none)
         {
-            if(el_front->src_el()->css().get_clear() == clear_both)
+            if(el_front->get_el()->src_el()->css().get_clear() == clear_both)
             {
                 was_cleared = true;
             } else
             {
-                if(	(flt == float_left	&& el_front->src_el()->css().get_clear() == clear_left) ||
-                       (flt == float_right	&& el_front->src_el()->css().get_clear() == clear_right) )
+                if(	(flt == float_left	&& el_front->get_el()->src_el()->css().get_clear() == clear_left) ||
+                       (flt == float_right	&& el_front->get_el()->src_el()->css().get_clear() == clear_right) )
                 {
                     was_cleared = true;
                 }
@@ -122,7 +138,7 @@ void litehtml::render_item_inline_context::fix_line_width(element_float flt,
 
         if(!was_cleared)
         {
-			std::list<std::unique_ptr<line_box_item> > items = std::move(m_line_boxes.back()->items());
+			line_box_item::vector items = std::move(m_line_boxes.back()->items());
             m_line_boxes.pop_back();
 
             for(auto& item : items)
@@ -162,9 +178,9 @@ void litehtml::render_item_inline_context::fix_line_width(element_float flt,
     }
 }
 
-std::list<std::unique_ptr<litehtml::line_box_item> > litehtml::render_item_inline_context::finish_last_box(bool end_of_render, const containing_block_context &self_size)
+litehtml::line_box_item::vector litehtml::render_item_inline_context::finish_last_box(bool end_of_render, const containing_block_context &self_size)
 {
-	std::list<std::unique_ptr<line_box_item> > ret;
+	line_box_item::vector ret;
 
     if(!m_line_boxes.empty())
     {
@@ -199,9 +215,9 @@ int litehtml::render_item_inline_context::new_box(const std::unique_ptr<line_box
 
     if(el->get_el()->src_el()->is_inline() || el->get_el()->src_el()->is_block_formatting_context())
     {
-        if (el->get_el()->width() > line_ctx.right - line_ctx.left)
+        if (el->width() > line_ctx.right - line_ctx.left)
         {
-            line_ctx.top = fmt_ctx->find_next_line_top(line_ctx.top, el->get_el()->width(), self_size.render_width);
+            line_ctx.top = fmt_ctx->find_next_line_top(line_ctx.top, el->width(), self_size.render_width);
             line_ctx.left = 0;
             line_ctx.right = self_size.render_width;
             line_ctx.fix_top();
@@ -282,10 +298,7 @@ void litehtml::render_item_inline_context::place_inline(std::unique_ptr<line_box
 			item->set_rendered_min_width(min_rendered_width);
 		} else if(item->get_el()->src_el()->css().get_display() == display_inline_text)
 		{
-			litehtml::size sz;
-			item->get_el()->src_el()->get_content_size(sz, line_ctx.right);
-			item->get_el()->pos() = sz;
-			item->set_rendered_min_width(sz.width);
+			item->set_rendered_min_width(item->width());
 		}
 	}
 
@@ -378,10 +391,21 @@ void litehtml::render_item_inline_context::apply_vertical_align()
             {
                 box->y_shift(add);
             }
+            update_text_runs();
+            // the line boxes don't match the cached layout anymore
+            invalidate_layout_cache();
         }
     }
 }
 
+void litehtml::render_item_inline_context::update_text_runs()
+{
+	for(auto& run : m_text_runs)
+	{
+		run->update_pos();
+	}
+}
+
 int litehtml::render_item_inline_context::get_base_line()
 {
     auto el_parent = parent();
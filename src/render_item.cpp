@@ -2,11 +2,19 @@
 #include "render_item.h"
 #include "document.h"
 #include <typeinfo>
+#include <climits>
 #include <utf8_strings.h>
 
+namespace
+{
+	// the ink box of the items that can draw anywhere
+	const litehtml::position unbounded_ink_box(INT_MIN / 4, INT_MIN / 4, INT_MAX / 2, INT_MAX / 2);
+}
+
 litehtml::render_item::render_item(std::shared_ptr<element>  _src_el) :
         m_element(std::move(_src_el)),
-        m_skip(false)
+        m_skip(false),
+        m_ink_box(unbounded_ink_box)
 {
     document::ptr doc = src_el()->get_document();
     auto fnt_size = src_el()->css().get_font_size();
@@ -31,6 +39,29 @@ int litehtml::render_item::render(int x, int y, const containing_block_context&
 {
 	int ret;
 
+	// Block formatting contexts and tables don't depend on the floats around them, so the layout of
+	// the subtree is defined by the containing block only. Shrink-to-fit and table sizing render the
+	// same subtree with the same containing block several times.
+	int generation = -1;
+	if(!fmt_ctx || src_el()->is_block_formatting_context() || src_el()->css().get_display() == display_table)
+	{
+		generation = src_el()->get_document()->layout_generation();
+		if(m_layout_cache.generation == generation &&
+			(second_pass || !m_layout_cache.second_pass) &&
+			m_layout_cache.cb_context == containing_block_size)
+		{
+			calc_outlines(containing_block_size.width);
+			m_margins = m_layout_cache.box_margins;
+			m_pos = m_layout_cache.pos;
+			m_pos.x += x;
+			m_pos.y += y;
+			return m_layout_cache.result;
+		}
+	}
+
+	m_layout_cache.generation	= -1;
+	m_layout_cache.second_pass	= second_pass;
+
 	calc_outlines(containing_block_size.width);
 
 	m_pos.clear();
@@ -55,6 +86,40 @@ int litehtml::render_item::render(int x, int y, const containing_block_context&
 		ret = _render(x, y, containing_block_size, fmt_ctx, second_pass);
 		fmt_ctx->pop_position(x + content_left, y + content_top);
 	}
+
+	m_layout_cache.generation	= generation;
+	if(generation != -1)
+	{
+		m_layout_cache.cb_context	= containing_block_size;
+		m_layout_cache.result		= ret;
+		m_layout_cache.box_margins	= m_margins;
+		m_layout_cache.pos			= m_pos;
+		m_layout_cache.pos.x		-= x;
+		m_layout_cache.pos.y		-= y;
+	}
+	return ret;
+}
+
+// Returns the width render() gives for the containing block. The results are reused during one
+// layout generation: table sizing measures the same cells with the same widths for every pass of
+// the enclosing tables.
+int litehtml::render_item::measure(const containing_block_context& containing_block_size)
+{
+	int generation = src_el()->get_document()->layout_generation();
+	if(m_measured_generation != generation)
+	{
+		m_measured_generation = generation;
+		m_measured_widths.clear();
+	}
+	for(const auto& item : m_measured_widths)
+	{
+		if(item.first == containing_block_size)
+		{
+			return item.second;
+		}
+	}
+	int ret = render(0, 0, containing_block_size, nullptr);
+	m_measured_widths.emplace_back(containing_block_size, ret);
 	return ret;
 }
 
@@ -115,25 +180,31 @@ int litehtml::render_item::calc_auto_margins(int parent_width)
 }
 
 void litehtml::render_item::apply_relative_shift(const containing_block_context &containing_block_size)
+{
+	apply_relative_shift(containing_block_size, m_pos);
+}
+
+// moves the box by the offsets of the relatively positioned element
+void litehtml::render_item::apply_relative_shift(const containing_block_context &containing_block_size, position& pos) const
 {
     if (src_el()->css().get_position() == element_position_relative)
     {
         css_offsets offsets = src_el()->css().get_offsets();
         if (!offsets.left.is_predefined())
         {
-            m_pos.x += offsets.left.calc_percent(containing_block_size.width);
+            pos.x += offsets.left.calc_percent(containing_block_size.width);
         }
         else if (!offsets.right.is_predefined())
         {
-            m_pos.x -= offsets.right.calc_percent(containing_block_size.width);
+            pos.x -= offsets.right.calc_percent(containing_block_size.width);
         }
         if (!offsets.top.is_predefined())
         {
-            m_pos.y += offsets.top.calc_percent(containing_block_size.height);
+            pos.y += offsets.top.calc_percent(containing_block_size.height);
         }
         else if (!offsets.bottom.is_predefined())
         {
-            m_pos.y -= offsets.bottom.calc_percent(containing_block_size.height);
+            pos.y -= offsets.bottom.calc_percent(containing_block_size.height);
         }
     }
 }
@@ -565,159 +636,367 @@ void litehtml::render_item::calc_document_size( litehtml::size& sz, litehtml::si
     }
 }
 
+// The ink box contains the borders, the margins and the inline boxes of the item and the ink boxes of the children.
+// It's larger than the painted area, but it's cheap and never misses anything that draw_stacking_context() paints.
+void litehtml::render_item::update_ink_box()
+{
+	for(const auto& el : m_children)
+	{
+		el->update_ink_box();
+	}
+	build_child_index();
+
+	const css_properties& css = src_el()->css();
+
+	// fixed boxes are drawn relative to the client rect
+	if(css.get_position() == element_position_fixed)
+	{
+		m_ink_box = unbounded_ink_box;
+		return;
+	}
+
+	m_ink_box = m_pos;
+	m_ink_box += m_padding;
+	m_ink_box += m_borders;
+	position margin_box = m_ink_box;
+	margin_box += m_margins;
+	m_ink_box.unite(margin_box);
+
+	position::vector boxes;
+	get_inline_boxes(boxes);
+	for(const auto& box : boxes)
+	{
+		m_ink_box.unite(box);
+	}
+
+	if(css.get_display() == display_list_item && css.get_list_style_type() != list_style_type_none)
+	{
+		// the marker is drawn at the left of the box, the marker image can be of any size
+		if(!css.get_list_style_image().empty())
+		{
+			m_ink_box = unbounded_ink_box;
+			return;
+		}
+		int line_height = css.get_line_height();
+		m_ink_box.x		= unbounded_ink_box.x;
+		m_ink_box.width	= unbounded_ink_box.width;
+		m_ink_box.y		-= line_height;
+		m_ink_box.height	+= line_height * 2;
+	}
+
+	for(const auto& el : m_children)
+	{
+		position box = el->m_ink_box;
+		box.x += m_pos.x;
+		box.y += m_pos.y;
+		m_ink_box.unite(box);
+	}
+}
+
 void litehtml::render_item::draw_stacking_context( uint_ptr hdc, int x, int y, const position* clip, bool with_positioned )
 {
     if(!is_visible()) return;
+    document::ptr doc = src_el()->get_document();
+    draw_statistics& stats = doc->get_draw_statistics();
+    if(!is_ink_visible(x, y, clip))
+    {
+        stats.culled++;
+        return;
+    }
 
-    std::map<int, bool> z_indexes;
-    if(with_positioned)
+    if(m_paint.generation != doc->layout_generation() || m_paint.with_positioned != with_positioned)
     {
-        for(const auto& idx : m_positioned)
-        {
-            z_indexes[idx->src_el()->css().get_z_index()];
-        }
+        build_paint_list(with_positioned);
+        m_paint.generation = doc->layout_generation();
+    }
 
-        for(const auto& idx : z_indexes)
+    position client;
+    bool has_client = false;
+    for(size_t i = 0; i < m_paint.ops.size(); i++)
+    {
+        const paint_op& op = m_paint.ops[i];
+        int op_x = x + op.x;
+        int op_y = y + op.y;
+        if(op.fixed)
         {
-            if(idx.first < 0)
+            if(!has_client)
             {
-                draw_children(hdc, x, y, clip, draw_positioned, idx.first);
+                doc->container()->get_client_rect(client);
+                has_client = true;
             }
+            op_x = client.x;
+            op_y = client.y;
+        }
+
+        switch(op.type)
+        {
+            case paint_op::op_group:
+            case paint_op::op_cull:
+                if(op.type == paint_op::op_group && !op.el->is_visible())
+                {
+                    i = op.index - 1;
+                } else if(!op.el->is_ink_visible(x + op.x, y + op.y, clip))
+                {
+                    stats.culled++;
+                    i = op.index - 1;
+                } else
+                {
+                    stats.visited++;
+                }
+                break;
+            case paint_op::op_draw:
+                op.el->src_el()->draw(hdc, op_x, op_y, clip, op.el);
+                break;
+            case paint_op::op_draw_background:
+                op.el->src_el()->draw_background(hdc, op_x, op_y, clip, op.el);
+                break;
+            case paint_op::op_stacking_context:
+                op.el->draw_stacking_context(hdc, op_x, op_y, clip, op.with_positioned);
+                break;
+            case paint_op::op_set_clip:
+                {
+                    position clip_pos = op.el->m_pos;
+                    clip_pos.x = op_x;
+                    clip_pos.y = op_y;
+                    doc->container()->set_clip(clip_pos, op.el->get_clip_radius());
+                }
+                break;
+            case paint_op::op_del_clip:
+                doc->container()->del_clip();
+                break;
         }
     }
-    draw_children(hdc, x, y, clip, draw_block, 0);
-    draw_children(hdc, x, y, clip, draw_floats, 0);
-    draw_children(hdc, x, y, clip, draw_inlines, 0);
+}
+
+// The positioned boxes with negative z-index, the in-flow blocks, the floats, the inlines, then the positioned
+// boxes with zero and positive z-index, each pass walks the children
+void litehtml::render_item::build_paint_list(bool with_positioned)
+{
+    m_paint.ops.clear();
+    m_paint.with_positioned = with_positioned;
+
+    std::vector<int> z_indexes;
     if(with_positioned)
     {
-        for(auto& z_index : z_indexes)
+        for(const auto& el : m_positioned)
         {
-            if(z_index.first == 0)
-            {
-                draw_children(hdc, x, y, clip, draw_positioned, z_index.first);
-            }
+            z_indexes.push_back(el->src_el()->css().get_z_index());
         }
+        std::sort(z_indexes.begin(), z_indexes.end());
+        z_indexes.erase(std::unique(z_indexes.begin(), z_indexes.end()), z_indexes.end());
+    }
 
-        for(auto& z_index : z_indexes)
-        {
-            if(z_index.first > 0)
-            {
-                draw_children(hdc, x, y, clip, draw_positioned, z_index.first);
-            }
-        }
+    auto zero = std::lower_bound(z_indexes.begin(), z_indexes.end(), 0);
+    for(auto z = z_indexes.begin(); z != zero; z++)
+    {
+        add_paint_ops(m_paint, 0, 0, draw_positioned, *z);
+    }
+    add_paint_ops(m_paint, 0, 0, draw_block, 0);
+    add_paint_ops(m_paint, 0, 0, draw_floats, 0);
+    add_paint_ops(m_paint, 0, 0, draw_inlines, 0);
+    for(auto z = zero; z != z_indexes.end(); z++)
+    {
+        add_paint_ops(m_paint, 0, 0, draw_positioned, *z);
     }
 }
 
-void litehtml::render_item::draw_children(uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex)
+litehtml::border_radiuses litehtml::render_item::get_clip_radius() const
 {
-    position pos = m_pos;
-    pos.x += x;
-    pos.y += y;
+    position border_box = m_pos;
+    border_box += m_padding;
+    border_box += m_borders;
 
-    document::ptr doc = src_el()->get_document();
+    border_radiuses bdr_radius = src_el()->css().get_borders().radius.calc_percents(border_box.width,
+                                                                                    border_box.height);
 
-    if (src_el()->css().get_overflow() > overflow_visible)
-    {
-        // TODO: Process overflow for inline elements
-        if(src_el()->css().get_display() != display_inline)
-        {
-            position border_box = pos;
-            border_box += m_padding;
-            border_box += m_borders;
+    bdr_radius -= m_borders;
+    bdr_radius -= m_padding;
+    return bdr_radius;
+}
 
-            border_radiuses bdr_radius = src_el()->css().get_borders().radius.calc_percents(border_box.width,
-                                                                                            border_box.height);
+void litehtml::render_item::add_paint_op(paint_list& list, paint_op::op_type type, const std::shared_ptr<render_item>& el, int x, int y, bool with_positioned)
+{
+    bool fixed = el && el->src_el()->css().get_position() == element_position_fixed;
+    list.ops.push_back({type, el, x, y, 0, fixed, with_positioned});
+}
 
-            bdr_radius -= m_borders;
-            bdr_radius -= m_padding;
+void litehtml::render_item::end_paint_group(paint_list& list, size_t index)
+{
+    if(list.ops.size() == index + 1)
+    {
+        list.ops.pop_back();
+    } else
+    {
+        list.ops[index].index = (int) list.ops.size();
+    }
+}
 
-            doc->container()->set_clip(pos, bdr_radius);
-        }
+void litehtml::render_item::add_paint_ops(paint_list& list, int x, int y, draw_flag flag, int zindex)
+{
+    position pos = m_pos;
+    pos.x += x;
+    pos.y += y;
+
+    // TODO: Process overflow for inline elements
+    bool overflow_clip = src_el()->css().get_overflow() > overflow_visible && src_el()->css().get_display() != display_inline;
+    size_t clip_index = list.ops.size();
+    if(overflow_clip)
+    {
+        list.ops.push_back({paint_op::op_set_clip, shared_from_this(), pos.x, pos.y, 0, false, false});
     }
 
     for (const auto& el : m_children)
     {
-        if (el->is_visible())
-        {
-            bool process = true;
-            switch (flag)
-            {
-                case draw_positioned:
-                    if (el->src_el()->is_positioned() && el->src_el()->css().get_z_index() == zindex)
-                    {
-                        if (el->src_el()->css().get_position() == element_position_fixed)
-                        {
-                            position browser_wnd;
-                            doc->container()->get_client_rect(browser_wnd);
+        size_t group = list.ops.size();
+        add_paint_op(list, paint_op::op_group, el, pos.x, pos.y);
 
-                            el->src_el()->draw(hdc, browser_wnd.x, browser_wnd.y, clip, el);
-                            el->draw_stacking_context(hdc, browser_wnd.x, browser_wnd.y, clip, true);
-                        }
-                        else
-                        {
-                            el->src_el()->draw(hdc, pos.x, pos.y, clip, el);
-                            el->draw_stacking_context(hdc, pos.x, pos.y, clip, true);
-                        }
-                        process = false;
-                    }
-                    break;
-                case draw_block:
-                    if (!el->src_el()->is_inline() && el->src_el()->css().get_float() == float_none && !el->src_el()->is_positioned())
-                    {
-                        el->src_el()->draw(hdc, pos.x, pos.y, clip, el);
-                    }
-                    break;
-                case draw_floats:
-                    if (el->src_el()->css().get_float() != float_none && !el->src_el()->is_positioned())
+        bool process = true;
+        switch (flag)
+        {
+            case draw_positioned:
+                if (el->src_el()->is_positioned() && el->src_el()->css().get_z_index() == zindex)
+                {
+                    add_paint_op(list, paint_op::op_draw, el, pos.x, pos.y);
+                    add_paint_op(list, paint_op::op_stacking_context, el, pos.x, pos.y, true);
+                    process = false;
+                }
+                break;
+            case draw_block:
+                if (!el->src_el()->is_inline() && el->src_el()->css().get_float() == float_none && !el->src_el()->is_positioned())
+                {
+                    add_paint_op(list, paint_op::op_draw, el, pos.x, pos.y);
+                }
+                break;
+            case draw_floats:
+                if (el->src_el()->css().get_float() != float_none && !el->src_el()->is_positioned())
+                {
+                    add_paint_op(list, paint_op::op_draw, el, pos.x, pos.y);
+                    add_paint_op(list, paint_op::op_stacking_context, el, pos.x, pos.y, false);
+                    process = false;
+                }
+                break;
+            case draw_inlines:
+                if (el->src_el()->is_inline() && el->src_el()->css().get_float() == float_none && !el->src_el()->is_positioned())
+                {
+                    add_paint_op(list, paint_op::op_draw, el, pos.x, pos.y);
+                    if (el->src_el()->css().get_display() == display_inline_block)
                     {
-                        el->src_el()->draw(hdc, pos.x, pos.y, clip, el);
-                        el->draw_stacking_context(hdc, pos.x, pos.y, clip, false);
+                        add_paint_op(list, paint_op::op_stacking_context, el, pos.x, pos.y, false);
                         process = false;
                     }
-                    break;
-                case draw_inlines:
-                    if (el->src_el()->is_inline() && el->src_el()->css().get_float() == float_none && !el->src_el()->is_positioned())
-                    {
-                        el->src_el()->draw(hdc, pos.x, pos.y, clip, el);
-                        if (el->src_el()->css().get_display() == display_inline_block)
-                        {
-                            el->draw_stacking_context(hdc, pos.x, pos.y, clip, false);
-                            process = false;
-                        }
-                    }
-                    break;
-                default:
-                    break;
-            }
+                }
+                break;
+            default:
+                break;
+        }
 
-            if (process)
+        if (process)
+        {
+            if (flag == draw_positioned)
             {
-                if (flag == draw_positioned)
+                if (!el->src_el()->is_positioned())
                 {
-                    if (!el->src_el()->is_positioned())
-                    {
-                        el->draw_children(hdc, pos.x, pos.y, clip, flag, zindex);
-                    }
+                    el->add_paint_ops(list, pos.x, pos.y, flag, zindex);
                 }
-                else
+            }
+            else
+            {
+                if (el->src_el()->css().get_float() == float_none &&
+                    el->src_el()->css().get_display() != display_inline_block &&
+                    !el->src_el()->is_positioned())
                 {
-                    if (el->src_el()->css().get_float() == float_none &&
-                        el->src_el()->css().get_display() != display_inline_block &&
-                        !el->src_el()->is_positioned())
-                    {
-                        el->draw_children(hdc, pos.x, pos.y, clip, flag, zindex);
-                    }
+                    el->add_paint_ops(list, pos.x, pos.y, flag, zindex);
                 }
             }
         }
+        end_paint_group(list, group);
     }
 
-    if (src_el()->css().get_overflow() > overflow_visible)
+    if(overflow_clip)
     {
-        doc->container()->del_clip();
+        if(list.ops.size() == clip_index + 1)
+        {
+            list.ops.pop_back();
+        } else
+        {
+            list.ops.push_back({paint_op::op_del_clip, nullptr, 0, 0, 0, false, false});
+        }
     }
 }
 
+void litehtml::render_item::build_child_index()
+{
+	m_child_index.step = 0;
+	m_child_index.buckets.clear();
+
+	// the short lists are scanned faster than indexed
+	const int min_children = 32;
+	int count = (int) m_children.size();
+	if(count < min_children)
+	{
+		return;
+	}
+
+	// the unbounded boxes (fixed boxes, list markers with images) are added to all buckets
+	auto is_bounded = [](const position& box)
+		{
+			return box.top() > unbounded_ink_box.top() && box.bottom() < unbounded_ink_box.bottom();
+		};
+	int top = INT_MAX;
+	int bottom = INT_MIN;
+	for(const auto& el : m_children)
+	{
+		if(is_bounded(el->m_ink_box))
+		{
+			top = std::min(top, el->m_ink_box.top());
+			bottom = std::max(bottom, el->m_ink_box.bottom());
+		}
+	}
+	if(top > bottom)
+	{
+		return;
+	}
+
+	int step = std::max(1, (bottom - top) / count + 1);
+	int buckets_count = (bottom - top) / step + 1;
+	auto first_bucket = [&](const position& box) { return is_bounded(box) ? (box.top() - top) / step : 0; };
+	auto last_bucket = [&](const position& box) { return is_bounded(box) ? (box.bottom() - top) / step : buckets_count - 1; };
+
+	// a child usually spans two buckets, the overlapping children would be copied into too many buckets
+	long long total = 0;
+	for(const auto& el : m_children)
+	{
+		total += last_bucket(el->m_ink_box) - first_bucket(el->m_ink_box) + 1;
+	}
+	if(total > (long long) count * 8)
+	{
+		return;
+	}
+
+	m_child_index.top = top;
+	m_child_index.step = step;
+	m_child_index.buckets.resize(buckets_count);
+	for(int i = 0; i < count; i++)
+	{
+		int last = last_bucket(m_children[i]->m_ink_box);
+		for(int b = first_bucket(m_children[i]->m_ink_box); b <= last; b++)
+		{
+			m_child_index.buckets[b].push_back(i);
+		}
+	}
+}
+
+const std::vector<int>* litehtml::render_item::child_index::find(int y) const
+{
+	if(!step)
+	{
+		return nullptr;
+	}
+	// the children of the outer buckets are checked for the points outside of the index too
+	int b = y < top ? 0 : std::min((y - top) / step, (int) buckets.size() - 1);
+	return &buckets[b];
+}
+
 std::shared_ptr<litehtml::element>  litehtml::render_item::get_child_by_point(int x, int y, int client_x, int client_y, draw_flag flag, int zindex)
 {
     element::ptr ret = nullptr;
@@ -734,9 +1013,17 @@ std::shared_ptr<litehtml::element>  litehtml::render_item::get_child_by_point(in
     el_pos.x	= x - el_pos.x;
     el_pos.y	= y - el_pos.y;
 
-    for(auto i = m_children.rbegin(); i != m_children.rend() && !ret; std::advance(i, 1))
+    // the candidates in the reverse order, the ink boxes of the fixed boxes and their ancestors are unbounded
+    const std::vector<int>* indexed = m_child_index.find(el_pos.y);
+    size_t count = indexed ? indexed->size() : m_children.size();
+    for(size_t n = count; n > 0 && !ret; n--)
     {
-        auto el = (*i);
+        const auto& child = m_children[indexed ? (*indexed)[n - 1] : n - 1];
+        if(!child->m_ink_box.is_point_inside(el_pos.x, el_pos.y))
+        {
+            continue;
+        }
+        auto el = child;
 
         if(el->is_visible() && el->src_el()->css().get_display() != display_inline_text)
         {
@@ -748,16 +1035,16 @@ std::shared_ptr<litehtml::element>  litehtml::render_item::get_child_by_point(in
                         if(el->src_el()->css().get_position() == element_position_fixed)
                         {
                             ret = el->get_element_by_point(client_x, client_y, client_x, client_y);
-                            if(!ret && (*i)->is_point_inside(client_x, client_y))
+                            if(!ret && child->is_point_inside(client_x, client_y))
                             {
-                                ret = (*i)->src_el();
+                                ret = child->src_el();
                             }
                         } else
                         {
                             ret = el->get_element_by_point(el_pos.x, el_pos.y, client_x, client_y);
-                            if(!ret && (*i)->is_point_inside(el_pos.x, el_pos.y))
+                            if(!ret && child->is_point_inside(el_pos.x, el_pos.y))
                             {
-                                ret = (*i)->src_el();
+                                ret = child->src_el();
                             }
                         }
                         el = nullptr;
@@ -777,9 +1064,9 @@ std::shared_ptr<litehtml::element>  litehtml::render_item::get_child_by_point(in
                     {
                         ret = el->get_element_by_point(el_pos.x, el_pos.y, client_x, client_y);
 
-                        if(!ret && (*i)->is_point_inside(el_pos.x, el_pos.y))
+                        if(!ret && child->is_point_inside(el_pos.x, el_pos.y))
                         {
-                            ret = (*i)->src_el();
+                            ret = child->src_el();
                         }
                         el = nullptr;
                     }
@@ -794,9 +1081,9 @@ std::shared_ptr<litehtml::element>  litehtml::render_item::get_child_by_point(in
                             ret = el->get_element_by_point(el_pos.x, el_pos.y, client_x, client_y);
                             el = nullptr;
                         }
-                        if(!ret && (*i)->is_point_inside(el_pos.x, el_pos.y))
+                        if(!ret && child->is_point_inside(el_pos.x, el_pos.y))
                         {
-                            ret = (*i)->src_el();
+                            ret = child->src_el();
                         }
                     }
                     break;
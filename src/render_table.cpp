@@ -53,7 +53,7 @@ int litehtml::render_item_table::_render(int x, int y, const containing_block_co
             table_cell* cell = m_grid->cell(0, row);
             if (cell && cell->el)
             {
-                cell->min_width = cell->max_width = cell->el->render(0, 0, self_size.new_width(self_size.render_width - table_width_spacing), fmt_ctx);
+                cell->min_width = cell->max_width = cell->el->max_content_width(self_size.new_width(self_size.render_width - table_width_spacing));
                 cell->el->pos().width = cell->min_width - cell->el->content_offset_left() -
 						cell->el->content_offset_right();
             }
@@ -71,7 +71,7 @@ int litehtml::render_item_table::_render(int x, int y, const containing_block_co
                     if (!m_grid->column(col).css_width.is_predefined() && m_grid->column(col).css_width.units() != css_units_percentage)
                     {
                         int css_w = m_grid->column(col).css_width.calc_percent(self_size.width);
-                        int el_w = cell->el->render(0, 0, self_size.new_width(css_w),fmt_ctx);
+                        int el_w = cell->el->measure(self_size.new_width(css_w));
                         cell->min_width = cell->max_width = std::max(css_w, el_w);
                         cell->el->pos().width = cell->min_width - cell->el->content_offset_left() -
 								cell->el->content_offset_right();
@@ -79,9 +79,9 @@ int litehtml::render_item_table::_render(int x, int y, const containing_block_co
                     else
                     {
                         // calculate minimum content width
-                        cell->min_width = cell->el->render(0, 0, self_size.new_width(cell->el->content_offset_width()), fmt_ctx);
+                        cell->min_width = cell->el->min_content_width(self_size);
                         // calculate maximum content width
-                        cell->max_width = cell->el->render(0, 0, self_size.new_width(self_size.render_width - table_width_spacing), fmt_ctx);
+                        cell->max_width = cell->el->max_content_width(self_size.new_width(self_size.render_width - table_width_spacing));
                     }
                 }
             }
@@ -432,7 +432,7 @@ std::shared_ptr<litehtml::render_item> litehtml::render_item_table::init()
     return shared_from_this();
 }
 
-void litehtml::render_item_table::draw_children(uint_ptr hdc, int x, int y, const position* clip, draw_flag flag, int zindex)
+void litehtml::render_item_table::add_paint_ops(paint_list& list, int x, int y, draw_flag flag, int zindex)
 {
     if (!m_grid) return;
 
@@ -441,28 +441,65 @@ void litehtml::render_item_table::draw_children(uint_ptr hdc, int x, int y, cons
     pos.y += y;
     for (auto& caption : m_grid->captions())
     {
+        size_t group = list.ops.size();
+        add_paint_op(list, paint_op::op_cull, caption, pos.x, pos.y);
         if (flag == draw_block)
         {
-            caption->src_el()->draw(hdc, pos.x, pos.y, clip, caption);
+            add_paint_op(list, paint_op::op_draw, caption, pos.x, pos.y);
         }
-        caption->draw_children(hdc, pos.x, pos.y, clip, flag, zindex);
+        caption->add_paint_ops(list, pos.x, pos.y, flag, zindex);
+        end_paint_group(list, group);
     }
     for (int row = 0; row < m_grid->rows_count(); row++)
     {
         if (flag == draw_block)
         {
-            m_grid->row(row).el_row->src_el()->draw_background(hdc, pos.x, pos.y, clip, m_grid->row(row).el_row);
+            add_paint_op(list, paint_op::op_draw_background, m_grid->row(row).el_row, pos.x, pos.y);
         }
         for (int col = 0; col < m_grid->cols_count(); col++)
         {
             table_cell* cell = m_grid->cell(col, row);
             if (cell->el)
             {
+                size_t group = list.ops.size();
+                add_paint_op(list, paint_op::op_cull, cell->el, pos.x, pos.y);
                 if (flag == draw_block)
                 {
-                    cell->el->src_el()->draw(hdc, pos.x, pos.y, clip, cell->el);
+                    add_paint_op(list, paint_op::op_draw, cell->el, pos.x, pos.y);
                 }
-                cell->el->draw_children(hdc, pos.x, pos.y, clip, flag, zindex);
+                cell->el->add_paint_ops(list, pos.x, pos.y, flag, zindex);
+                end_paint_group(list, group);
+            }
+        }
+    }
+}
+
+// The captions and the cells are drawn relative to the table, not to their parents in the render tree
+void litehtml::render_item_table::update_ink_box()
+{
+    render_item::update_ink_box();
+    if (!m_grid) return;
+
+    auto add_ink = [this](const std::shared_ptr<render_item>& el)
+        {
+            position box = el->ink_box();
+            box.x += m_pos.x;
+            box.y += m_pos.y;
+            m_ink_box.unite(box);
+        };
+    for (auto& caption : m_grid->captions())
+    {
+        add_ink(caption);
+    }
+    for (int row = 0; row < m_grid->rows_count(); row++)
+    {
+        add_ink(m_grid->row(row).el_row);
+        for (int col = 0; col < m_grid->cols_count(); col++)
+        {
+            table_cell* cell = m_grid->cell(col, row);
+            if (cell->el)
+            {
+                add_ink(cell->el);
             }
         }
     }
@@ -1,20 +1,176 @@
 #include "html.h"
 #include "string_id.h"
 #include <assert.h>
+#include <unordered_map>
 
 #ifndef LITEHTML_NO_THREADS
 	#include <mutex>
-	static std::mutex mutex;
-	#define lock_guard std::lock_guard<std::mutex> lock(mutex)
+	#include <atomic>
+	#define lock_guard(m) std::lock_guard<std::mutex> lock(m)
 #else
-	#define lock_guard
+	#define lock_guard(m)
 #endif
 
 namespace litehtml
 {
 
-static std::map<string, string_id> map;
-static std::vector<string> array;
+// FNV-1a with a final mix, seed selects one function of the family
+static unsigned hash_string(const string& str, unsigned seed)
+{
+	unsigned h = 2166136261u ^ (seed * 0x9E3779B1u);
+	for (unsigned char c : str)
+	{
+		h ^= c;
+		h *= 16777619u;
+	}
+	h ^= h >> 15;
+	h *= 0x85EBCA77u;
+	h ^= h >> 13;
+	return h;
+}
+
+// Storage of the names. Strings are never moved once added, so _s() reads them without a lock.
+class names_storage
+{
+	static const int chunk_bits = 12;
+	static const int chunk_size = 1 << chunk_bits;
+	static const int max_chunks = 4096;
+
+#ifndef LITEHTML_NO_THREADS
+	std::atomic<string*>	m_chunks[max_chunks];
+	std::atomic<int>		m_count;
+#else
+	string*					m_chunks[max_chunks];
+	int						m_count;
+#endif
+public:
+	names_storage() : m_count(0)
+	{
+		for (auto& chunk : m_chunks) chunk = nullptr;
+	}
+
+	// the caller must hold the lock of the name's shard
+	int add(const string& str)
+	{
+		int id = m_count++;
+		int chunk_idx = id >> chunk_bits;
+		assert(chunk_idx < max_chunks);
+
+		string* chunk = m_chunks[chunk_idx];
+		if (!chunk)
+		{
+			string* new_chunk = new string[chunk_size];
+#ifndef LITEHTML_NO_THREADS
+			// another shard can allocate the same chunk concurrently
+			if (m_chunks[chunk_idx].compare_exchange_strong(chunk, new_chunk))
+			{
+				chunk = new_chunk;
+			} else
+			{
+				delete[] new_chunk;
+			}
+#else
+			m_chunks[chunk_idx] = chunk = new_chunk;
+#endif
+		}
+		chunk[id & (chunk_size - 1)] = str;
+		return id;
+	}
+
+	const string& get(int id) const
+	{
+		const string* chunk = m_chunks[id >> chunk_bits];
+		return chunk[id & (chunk_size - 1)];
+	}
+};
+
+// Hash-and-displace perfect hash over the built-in STRING_ID names. It is built once
+// during static initialization and is read-only after that.
+class builtin_names_table
+{
+	std::vector<unsigned>	m_displacements;	// hash seed for every bucket
+	std::vector<int>		m_slots;			// string_id or -1
+	unsigned				m_mask = 0;
+public:
+	void build(const string_vector& names)
+	{
+		unsigned size = 1;
+		while (size < names.size() * 2) size <<= 1;
+		m_mask = size - 1;
+		m_slots.assign(size, -1);
+		m_displacements.assign(names.size() / 4 + 1, 0);
+
+		std::vector<std::vector<int>> buckets(m_displacements.size());
+		for (int i = 0; i < (int) names.size(); i++)
+		{
+			buckets[hash_string(names[i], 0) % buckets.size()].push_back(i);
+		}
+
+		// place the largest buckets first, while the table is empty
+		std::vector<int> order(buckets.size());
+		for (int i = 0; i < (int) order.size(); i++) order[i] = i;
+		std::sort(order.begin(), order.end(), [&](int a, int b) { return buckets[a].size() > buckets[b].size(); });
+
+		std::vector<unsigned> positions;
+		for (int b : order)
+		{
+			for (unsigned seed = 1; !buckets[b].empty(); seed++)
+			{
+				positions.clear();
+				bool fits = true;
+				for (int i : buckets[b])
+				{
+					unsigned pos = hash_string(names[i], seed) & m_mask;
+					if (m_slots[pos] != -1 || std::find(positions.begin(), positions.end(), pos) != positions.end())
+					{
+						fits = false;
+						break;
+					}
+					positions.push_back(pos);
+				}
+				if (fits)
+				{
+					for (size_t i = 0; i < positions.size(); i++)
+					{
+						m_slots[positions[i]] = buckets[b][i];
+					}
+					m_displacements[b] = seed;
+					break;
+				}
+			}
+		}
+	}
+
+	// returns -1 for names that are not built-in
+	// hash is hash_string(str, 0)
+	int find(const string& str, unsigned hash, const names_storage& storage) const
+	{
+		if (m_displacements.empty()) return -1;
+
+		unsigned seed = m_displacements[hash % m_displacements.size()];
+		int id = m_slots[hash_string(str, seed) & m_mask];
+		if (id != -1 && storage.get(id) == str)
+		{
+			return id;
+		}
+		return -1;
+	}
+};
+
+// Names added at runtime, split between shards to reduce lock contention
+struct names_shard
+{
+#ifndef LITEHTML_NO_THREADS
+	std::mutex								mutex;
+#endif
+	std::unordered_map<string, string_id>	map;
+};
+
+static const int shards_count = 16;
+
+static names_storage		storage;
+static builtin_names_table	builtin_names;
+static names_shard			shards[shards_count];
 
 static int init()
 {
@@ -26,8 +182,9 @@ static int init()
 		assert(name[0] == '_' && name.back() == '_');
 		name = name.substr(1, name.size() - 2);				// _border_color_ -> border_color
 		std::replace(name.begin(), name.end(), '_', '-');	// border_color   -> border-color
-		_id(name);  // this will create association _border_color_ <-> "border-color"
+		storage.add(name);	// this will create association _border_color_ <-> "border-color"
 	}
+	builtin_names.build(names);
 	return 0;
 }
 static int dummy = init();
@@ -37,18 +194,23 @@ const string_id star_id = _id("*");
 
 string_id _id(const string& str)
 {
-	lock_guard;
-	auto it = map.find(str);
-	if (it != map.end()) return it->second;
-	// else: str not found, add it to the array and the map
-	array.push_back(str);
-	return map[str] = (string_id)(array.size() - 1);
+	unsigned hash = hash_string(str, 0);
+	int id = builtin_names.find(str, hash, storage);
+	if (id != -1) return (string_id) id;
+
+	names_shard& shard = shards[hash & (shards_count - 1)];
+	lock_guard(shard.mutex);
+	auto it = shard.map.find(str);
+	if (it != shard.map.end()) return it->second;
+	// else: str not found, add it to the storage and the map
+	string_id new_id = (string_id) storage.add(str);
+	shard.map[str] = new_id;
+	return new_id;
 }
 
 const string& _s(string_id id)
 {
-	lock_guard;
-	return array[id];
+	return storage.get(id);
 }
 
-} // namespace litehtml
\ No newline at end of file
+} // namespace litehtml
@@ -1,10 +1,12 @@
 #include "html.h"
 #include "style.h"
+#include <algorithm>
 
 namespace litehtml
 {
 
-std::map<string_id, string> style::m_valid_values =
+// read-only after static initialization, documents on different threads share it
+const std::map<string_id, string> style::m_valid_values =
 {
 	{ _display_, style_display_strings },
 	{ _visibility_, visibility_strings },
@@ -48,6 +50,13 @@ std::map<string_id, string> style::m_valid_values =
 	{ _caption_side_, caption_side_strings },
 };
 
+const string& style::valid_values(string_id name)
+{
+	static const string empty;
+	auto it = m_valid_values.find(name);
+	return it != m_valid_values.end() ? it->second : empty;
+}
+
 void style::parse(const string& txt, const string& baseurl, document_container* container)
 {
 	std::vector<string> properties;
@@ -134,7 +143,7 @@ void style::add_property(string_id name, const string& val, const string& baseur
 
 	case _caption_side_:
 
-		idx = value_index(val, m_valid_values[name]);
+		idx = value_index(val, valid_values(name));
 		if (idx >= 0)
 		{
 			add_parsed_property(name, property_value(idx, important));
@@ -768,7 +777,7 @@ void style::parse_keyword_comma_list(string_id name, const string& val, bool imp
 	for (auto& token : tokens)
 	{
 		trim(token);
-		int idx = value_index(token, m_valid_values[name]);
+		int idx = value_index(token, valid_values(name));
 		if (idx == -1) return;
 		vec.push_back(idx);
 	}
@@ -1076,10 +1085,23 @@ void style::parse_flex(const string& val, bool important)
 	}
 }
 
+// returns the position of the property or the position to insert it at
+props_map::iterator style::find_property(string_id name)
+{
+	return std::lower_bound(m_properties.begin(), m_properties.end(), name,
+		[](const props_map::value_type& prop, string_id id) { return prop.first < id; });
+}
+
+props_map::const_iterator style::find_property(string_id name) const
+{
+	return std::lower_bound(m_properties.begin(), m_properties.end(), name,
+		[](const props_map::value_type& prop, string_id id) { return prop.first < id; });
+}
+
 void style::add_parsed_property( string_id name, const property_value& propval )
 {
-	auto prop = m_properties.find(name);
-	if (prop != m_properties.end())
+	auto prop = find_property(name);
+	if (prop != m_properties.end() && prop->first == name)
 	{
 		if (!prop->second.m_important || (propval.m_important && prop->second.m_important))
 		{
@@ -1088,14 +1110,14 @@ void style::add_parsed_property( string_id name, const property_value& propval )
 	}
 	else
 	{
-		m_properties[name] = propval;
+		m_properties.insert(prop, props_map::value_type(name, propval));
 	}
 }
 
 void style::remove_property( string_id name, bool important )
 {
-	auto prop = m_properties.find(name);
-	if(prop != m_properties.end())
+	auto prop = find_property(name);
+	if(prop != m_properties.end() && prop->first == name)
 	{
 		if( !prop->second.m_important || (important && prop->second.m_important) )
 		{
@@ -1106,16 +1128,110 @@ void style::remove_property( string_id name, bool important )
 
 void style::combine(const style& src)
 {
-	for (const auto& property : src.m_properties)
+	if (m_properties.empty())
+	{
+		m_properties = src.m_properties;
+		return;
+	}
+
+	// both lists are sorted, so merge them in one pass
+	props_map merged;
+	merged.reserve(m_properties.size() + src.m_properties.size());
+
+	auto dst_it = m_properties.begin();
+	auto src_it = src.m_properties.begin();
+	while (dst_it != m_properties.end() || src_it != src.m_properties.end())
+	{
+		if (src_it == src.m_properties.end() || (dst_it != m_properties.end() && dst_it->first < src_it->first))
+		{
+			merged.push_back(std::move(*dst_it++));
+		} else if (dst_it == m_properties.end() || src_it->first < dst_it->first)
+		{
+			merged.push_back(*src_it++);
+		} else
+		{
+			if (!dst_it->second.m_important || (src_it->second.m_important && dst_it->second.m_important))
+			{
+				merged.push_back(*src_it);
+			} else
+			{
+				merged.push_back(std::move(*dst_it));
+			}
+			dst_it++;
+			src_it++;
+		}
+	}
+	m_properties.swap(merged);
+}
+
+// The properties that are read only while drawing
+static style_change property_change(string_id name)
+{
+	switch(name)
+	{
+	case _cursor_:
+		return style_change_style;
+
+	case _color_:
+	case _visibility_:
+	case _text_decoration_:
+	case _background_:
+	case _background_color_:
+	case _background_image_:
+	case _background_image_baseurl_:
+	case _background_repeat_:
+	case _background_origin_:
+	case _background_clip_:
+	case _background_attachment_:
+	case _background_size_:
+	case _background_position_:
+	case _background_position_x_:
+	case _background_position_y_:
+	case _border_color_:
+	case _border_left_color_:
+	case _border_right_color_:
+	case _border_top_color_:
+	case _border_bottom_color_:
+	case _border_radius_:
+	case _border_radius_x_:
+	case _border_radius_y_:
+	case _border_bottom_left_radius_:
+	case _border_bottom_left_radius_x_:
+	case _border_bottom_left_radius_y_:
+	case _border_bottom_right_radius_:
+	case _border_bottom_right_radius_x_:
+	case _border_bottom_right_radius_y_:
+	case _border_top_left_radius_:
+	case _border_top_left_radius_x_:
+	case _border_top_left_radius_y_:
+	case _border_top_right_radius_:
+	case _border_top_right_radius_x_:
+	case _border_top_right_radius_y_:
+		return style_change_paint;
+
+	default:
+		return style_change_layout;
+	}
+}
+
+style_change style::get_change() const
+{
+	style_change ret = style_change_none;
+	for(const auto& prop : m_properties)
 	{
-		add_parsed_property(property.first, property.second);
+		ret = std::max(ret, property_change(prop.first));
+		if(ret == style_change_layout)
+		{
+			break;
+		}
 	}
+	return ret;
 }
 
 const property_value& style::get_property(string_id name) const
 {
-	auto it = m_properties.find(name);
-	if (it != m_properties.end())
+	auto it = find_property(name);
+	if (it != m_properties.end() && it->first == name)
 	{
 		return it->second;
 	}
@@ -1141,15 +1257,20 @@ void style::subst_vars_(string& str, const element* el)
 
 void style::subst_vars(const element* el)
 {
-	for (auto& prop : m_properties)
+	// add_property can insert into m_properties, so walk it by index and copy the value first
+	for (size_t i = 0; i < m_properties.size(); i++)
 	{
+		auto& prop = m_properties[i];
 		if (prop.second.m_type == prop_type_var)
 		{
 			subst_vars_(prop.second.m_string, el);
+			string_id name = prop.first;
+			string val = prop.second.m_string;
+			bool important = prop.second.m_important;
 			// re-adding the same property
 			// if it is a custom property it will be readded as a string (currently it is prop_type_var)
 			// if it is a standard css property it will be parsed and properly added as typed property
-			add_property(prop.first, prop.second.m_string, "", prop.second.m_important, el->get_document()->container());
+			add_property(name, val, "", important, el->get_document()->container());
 		}
 	}
 }
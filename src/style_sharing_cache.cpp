@@ -0,0 +1,33 @@
+#include "html.h"
+#include "style_sharing_cache.h"
+#include "html_tag.h"
+
+std::shared_ptr<litehtml::html_tag> litehtml::style_sharing_cache::find(const html_tag& el)
+{
+	for(const auto& candidate : m_candidates)
+	{
+		std::shared_ptr<html_tag> sibling = candidate.lock();
+		if(sibling && el.can_share_style(*sibling))
+		{
+			m_hits++;
+			return sibling;
+		}
+	}
+	m_misses++;
+	return nullptr;
+}
+
+void litehtml::style_sharing_cache::add(const std::shared_ptr<html_tag>& el)
+{
+	m_candidates[m_next] = el;
+	m_next = (m_next + 1) % max_candidates;
+}
+
+void litehtml::style_sharing_cache::clear()
+{
+	for(auto& candidate : m_candidates)
+	{
+		candidate.reset();
+	}
+	m_next = 0;
+}
@@ -58,7 +58,7 @@ void litehtml::css::parse_stylesheet(const char* str, const char* baseurl, const
 		{
 			auto str_style = text.substr(style_start + 1, style_end - style_start - 1);
 			style::ptr style = std::make_shared<litehtml::style>();
-			style->add(str_style, baseurl ? baseurl : "", doc->container());
+			style->add(str_style, baseurl ? baseurl : "", doc ? doc->container() : nullptr);
 
 			parse_selectors(text.substr(pos, style_start - pos), style, media);
 
@@ -80,6 +80,17 @@ void litehtml::css::parse_stylesheet(const char* str, const char* baseurl, const
 	}
 }
 
+litehtml::css::const_ptr litehtml::css::create_shared(const char* str)
+{
+	css::ptr sheet = std::make_shared<css>();
+	if(str && *str)
+	{
+		sheet->parse_stylesheet(str, nullptr, nullptr, nullptr);
+		sheet->sort_selectors();
+	}
+	return sheet;
+}
+
 void litehtml::css::parse_css_url( const string& str, string& url )
 {
 	url = "";
@@ -122,6 +133,7 @@ bool litehtml::css::parse_selectors( const string& txt, const style::ptr& styles
 		if(new_selector->parse(token))
 		{
 			new_selector->calc_specificity();
+			new_selector->calc_ancestor_hashes();
 			add_selector(new_selector);
 			added_something = true;
 		}
@@ -130,6 +142,40 @@ bool litehtml::css::parse_selectors( const string& txt, const style::ptr& styles
 	return added_something;
 }
 
+// Appends the selectors of a stylesheet shared by several documents. The copies share the parsed
+// styles but get their own media query lists, because the lists keep the result of the last
+// evaluation against the document media. Rules outside @media get the media of the stylesheet.
+void litehtml::css::add_selectors(const css& src, const media_query_list::ptr& media, const std::shared_ptr<document>& doc)
+{
+	std::map<media_query_list*, media_query_list::ptr> media_lists;
+	for(const auto& sel : src.m_selectors)
+	{
+		media_query_list::ptr sel_media = media;
+		if(sel->m_media_query)
+		{
+			media_query_list::ptr& list = media_lists[sel->m_media_query.get()];
+			if(!list)
+			{
+				list = std::make_shared<media_query_list>(*sel->m_media_query);
+			}
+			sel_media = list;
+		}
+		if(sel_media && doc)
+		{
+			doc->add_media_list(sel_media);
+		}
+
+		css_selector::ptr new_selector = std::make_shared<css_selector>(sel_media);
+		new_selector->m_specificity	= sel->m_specificity;
+		new_selector->m_right		= sel->m_right;
+		new_selector->m_left		= sel->m_left;
+		new_selector->m_combinator	= sel->m_combinator;
+		new_selector->m_style		= sel->m_style;
+		memcpy(new_selector->m_ancestor_hashes, sel->m_ancestor_hashes, sizeof(sel->m_ancestor_hashes));
+		add_selector(new_selector);
+	}
+}
+
 void litehtml::css::sort_selectors()
 {
 	std::sort(m_selectors.begin(), m_selectors.end(),
@@ -138,6 +184,85 @@ void litehtml::css::sort_selectors()
 			 return (*v1) < (*v2);
 		 }
 	);
+	build_buckets();
+}
+
+void litehtml::css::build_buckets()
+{
+	m_id_selectors.clear();
+	m_class_selectors.clear();
+	m_tag_selectors.clear();
+	m_universal_selectors.clear();
+
+	// m_selectors is sorted here, so every bucket keeps specificity/order sorting
+	for(const auto& sel : m_selectors)
+	{
+		const css_element_selector& right = sel->m_right;
+
+		string_id id_key = empty_id;
+		string_id class_key = empty_id;
+		for(const auto& attr : right.m_attrs)
+		{
+			if(attr.type == select_id && id_key == empty_id)
+			{
+				id_key = attr.name;
+			} else if(attr.type == select_class && class_key == empty_id)
+			{
+				class_key = attr.name;
+			}
+		}
+
+		if(id_key != empty_id)
+		{
+			m_id_selectors[id_key].push_back(sel);
+		} else if(class_key != empty_id)
+		{
+			m_class_selectors[class_key].push_back(sel);
+		} else if(right.m_tag != star_id)
+		{
+			m_tag_selectors[right.m_tag].push_back(sel);
+		} else
+		{
+			m_universal_selectors.push_back(sel);
+		}
+	}
+}
+
+void litehtml::css::get_candidate_selectors(string_id tag, string_id id, const std::vector<string_id>& classes, css_selector::vector& res) const
+{
+	res.clear();
+
+	auto add_bucket = [&](const selectors_map& buckets, string_id key)
+		{
+			auto iter = buckets.find(key);
+			if(iter != buckets.end())
+			{
+				res.insert(res.end(), iter->second.begin(), iter->second.end());
+			}
+		};
+
+	if(id != empty_id)
+	{
+		add_bucket(m_id_selectors, id);
+	}
+	for(auto cls = classes.begin(); cls != classes.end(); cls++)
+	{
+		// skip duplicated class names, each selector must be added once
+		if(std::find(classes.begin(), cls, *cls) == cls)
+		{
+			add_bucket(m_class_selectors, *cls);
+		}
+	}
+	add_bucket(m_tag_selectors, tag);
+	res.insert(res.end(), m_universal_selectors.begin(), m_universal_selectors.end());
+
+	// restore the cascade order of the merged buckets
+	std::sort(res.begin(), res.end(),
+		[](const css_selector::ptr& v1, const css_selector::ptr& v2)
+		{
+			return (*v1) < (*v2);
+		}
+	);
 }
 
 void litehtml::css::parse_atrule(const string& text, const char* baseurl, const std::shared_ptr<document>& doc, const media_query_list::ptr& media)
@@ -0,0 +1,150 @@
+#include "html.h"
+#include "stylesheet_cache.h"
+
+#ifndef LITEHTML_NO_THREADS
+	#define lock_guard(m) std::lock_guard<std::mutex> lock(m)
+#else
+	#define lock_guard(m)
+#endif
+
+litehtml::stylesheet_cache& litehtml::stylesheet_cache::instance()
+{
+	static stylesheet_cache cache;
+	return cache;
+}
+
+litehtml::css::const_ptr litehtml::stylesheet_cache::find(const document_container* container, const string& text, const string& baseurl, int font_size)
+{
+	key k = {container, hash(text), baseurl, font_size};
+
+	lock_guard(m_mutex);
+	if(!m_enabled || !m_max_size)
+	{
+		return nullptr;
+	}
+	auto iter = m_index.find(k);
+	if(iter == m_index.end() || iter->second->text != text)
+	{
+		m_stats.misses++;
+		return nullptr;
+	}
+	m_stats.hits++;
+	m_entries.splice(m_entries.begin(), m_entries, iter->second);
+	return iter->second->sheet;
+}
+
+void litehtml::stylesheet_cache::add(const document_container* container, const string& text, const string& baseurl, int font_size, const css::const_ptr& sheet)
+{
+	key k = {container, hash(text), baseurl, font_size};
+
+	lock_guard(m_mutex);
+	if(!m_enabled || text.length() > m_max_size)
+	{
+		return;
+	}
+	auto iter = m_index.find(k);
+	if(iter != m_index.end())
+	{
+		// another document has parsed the same text meanwhile, or the hashes collide
+		erase(iter->second);
+	}
+	evict(m_max_size - text.length());
+
+	m_entries.push_front({k, text, sheet});
+	m_index[k] = m_entries.begin();
+	m_stats.size += text.length();
+	m_stats.entries = (int) m_entries.size();
+}
+
+void litehtml::stylesheet_cache::clear()
+{
+	lock_guard(m_mutex);
+	m_entries.clear();
+	m_index.clear();
+	m_stats = statistics();
+}
+
+void litehtml::stylesheet_cache::clear(const document_container* container)
+{
+	lock_guard(m_mutex);
+	for(auto iter = m_entries.begin(); iter != m_entries.end();)
+	{
+		auto next = std::next(iter);
+		if(iter->k.container == container)
+		{
+			erase(iter);
+		}
+		iter = next;
+	}
+	m_stats.entries = (int) m_entries.size();
+}
+
+bool litehtml::stylesheet_cache::enabled() const
+{
+	lock_guard(m_mutex);
+	return m_enabled;
+}
+
+void litehtml::stylesheet_cache::set_enabled(bool enabled)
+{
+	lock_guard(m_mutex);
+	m_enabled = enabled;
+	if(!enabled)
+	{
+		m_entries.clear();
+		m_index.clear();
+		m_stats.size = 0;
+		m_stats.entries = 0;
+	}
+}
+
+size_t litehtml::stylesheet_cache::max_size() const
+{
+	lock_guard(m_mutex);
+	return m_max_size;
+}
+
+void litehtml::stylesheet_cache::set_max_size(size_t max_size)
+{
+	lock_guard(m_mutex);
+	m_max_size = max_size;
+	evict(max_size);
+}
+
+litehtml::stylesheet_cache::statistics litehtml::stylesheet_cache::get_statistics() const
+{
+	lock_guard(m_mutex);
+	return m_stats;
+}
+
+// FNV-1a
+size_t litehtml::stylesheet_cache::hash(const string& text)
+{
+	unsigned long long h = 14695981039346656037ull;
+	for(unsigned char c : text)
+	{
+		h ^= c;
+		h *= 1099511628211ull;
+	}
+	return (size_t) h;
+}
+
+// the caller must hold the lock
+void litehtml::stylesheet_cache::erase(entries_list::iterator iter)
+{
+	m_stats.size -= iter->text.length();
+	m_index.erase(iter->k);
+	m_entries.erase(iter);
+}
+
+// removes the least recently used stylesheets until the cached text fits into max_size
+// the caller must hold the lock
+void litehtml::stylesheet_cache::evict(size_t max_size)
+{
+	while(!m_entries.empty() && m_stats.size > max_size)
+	{
+		m_stats.evictions++;
+		erase(std::prev(m_entries.end()));
+	}
+	m_stats.entries = (int) m_entries.size();
+}
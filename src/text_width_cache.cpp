@@ -0,0 +1,80 @@
+#include "html.h"
+#include "text_width_cache.h"
+
+// FNV-1a of the text mixed with the font
+size_t litehtml::text_width_cache::key_hash::operator()(const key& k) const
+{
+	unsigned long long h = 14695981039346656037ull ^ (unsigned long long) k.font;
+	for(unsigned char c : k.text)
+	{
+		h ^= c;
+		h *= 1099511628211ull;
+	}
+	return (size_t) h;
+}
+
+bool litehtml::text_width_cache::find(uint_ptr font, const char* text, int& width)
+{
+	if(!m_max_entries)
+	{
+		return false;
+	}
+	m_lookup.font = font;
+	m_lookup.text = text;
+	auto iter = m_index.find(m_lookup);
+	if(iter == m_index.end())
+	{
+		m_stats.misses++;
+		return false;
+	}
+	m_stats.hits++;
+	m_lru.splice(m_lru.begin(), m_lru, iter->second.lru);
+	width = iter->second.width;
+	return true;
+}
+
+void litehtml::text_width_cache::add(uint_ptr font, const char* text, int width)
+{
+	if(!m_max_entries)
+	{
+		return;
+	}
+	auto inserted = m_index.emplace(key{font, text}, entry{width, m_lru.end()});
+	if(inserted.second)
+	{
+		m_lru.push_front(&inserted.first->first);
+	} else
+	{
+		// the text was added without find()
+		inserted.first->second.width = width;
+		m_lru.erase(inserted.first->second.lru);
+		m_lru.push_front(&inserted.first->first);
+	}
+	inserted.first->second.lru = m_lru.begin();
+	evict(m_max_entries);
+}
+
+void litehtml::text_width_cache::clear()
+{
+	m_lru.clear();
+	m_index.clear();
+	m_stats = statistics();
+}
+
+void litehtml::text_width_cache::set_max_entries(size_t max_entries)
+{
+	m_max_entries = max_entries;
+	evict(max_entries);
+}
+
+// removes the least recently used widths until there are max_entries of them
+void litehtml::text_width_cache::evict(size_t max_entries)
+{
+	while(m_lru.size() > max_entries)
+	{
+		m_stats.evictions++;
+		m_index.erase(m_index.find(*m_lru.back()));
+		m_lru.pop_back();
+	}
+	m_stats.entries = (int) m_index.size();
+}
@@ -0,0 +1,356 @@
+#define _CRT_SECURE_NO_WARNINGS
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+#ifdef _WIN32
+	#include "dirent.h"
+#else
+	#include <dirent.h>
+#endif
+#include "gumbo.h"
+#include "../containers/test/test_container.h"
+#include "../containers/test/Font.h"	// includes Bitmap.h
+using namespace std;
+
+// Benchmarks of the document loading phases, the layout and the drawing over the documents of
+// test/render and over large synthetic documents. The "allocs" counter is the number of allocations
+// per iteration. The phases of the loading are timed by the document (see load_statistics), the
+// benchmarks of these phases load the whole document in every iteration, so their "load_allocs"
+// counter is the number of allocations of the whole loading, not of the phase.
+//
+//   litehtml_benchmarks --benchmark_filter='render/.*' --benchmark_counters_tabular=true
+
+#ifndef LITEHTML_SOURCE_DIR
+	#define LITEHTML_SOURCE_DIR ".."	// run from litehtml/build
+#endif
+
+static const char* test_dir = LITEHTML_SOURCE_DIR "/test/render/";
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// allocation counting
+
+static std::atomic<long long> allocations(0);
+
+// the replacements are not inlined, otherwise the compiler sees new paired with free() and warns
+#ifdef _MSC_VER
+	#define NOINLINE __declspec(noinline)
+#else
+	#define NOINLINE __attribute__((noinline))
+#endif
+
+NOINLINE void* operator new(size_t size)
+{
+	allocations++;
+	void* ptr = malloc(size ? size : 1);
+	if (!ptr) throw std::bad_alloc();
+	return ptr;
+}
+NOINLINE void* operator new[](size_t size)			{ return operator new(size); }
+NOINLINE void operator delete(void* ptr) noexcept	{ free(ptr); }
+NOINLINE void operator delete[](void* ptr) noexcept	{ free(ptr); }
+NOINLINE void operator delete(void* ptr, size_t) noexcept	{ free(ptr); }
+NOINLINE void operator delete[](void* ptr, size_t) noexcept	{ free(ptr); }
+
+// the allocator of gumbo_parse_with_options()
+static void* gumbo_alloc(void*, size_t size)	{ allocations++; return malloc(size); }
+static void gumbo_free(void*, void* ptr)		{ free(ptr); }
+
+namespace
+{
+	// sets the counter to the allocations of the benchmark loop
+	class alloc_counter
+	{
+		long long m_start;
+	public:
+		alloc_counter() : m_start(allocations) {}
+
+		void report(benchmark::State& state, const char* counter = "allocs") const
+		{
+			state.counters[counter] =benchmark::Counter(double(allocations - m_start), benchmark::Counter::kAvgIterations);
+		}
+	};
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// documents
+
+string readfile(string filename)
+{
+	stringstream ss;
+	ifstream(filename) >> ss.rdbuf();
+	return ss.str();
+}
+
+namespace
+{
+	struct sample
+	{
+		string			name;
+		vector<string>	html;	// every benchmark iteration processes all documents of the sample
+	};
+
+	// the documents of the render tests
+	sample render_corpus()
+	{
+		sample ret = {"corpus", {}};
+		DIR* dir = opendir(test_dir);
+		if (!dir) return ret;
+		vector<string> names;
+		while (dirent* ent = readdir(dir))
+		{
+			string name = ent->d_name;
+			if (name[0] != '-' && name.size() > 4 && name.substr(name.size() - 4) == ".htm")
+				names.push_back(name);
+		}
+		closedir(dir);
+		sort(names.begin(), names.end());
+		for (const auto& name : names)
+		{
+			ret.html.push_back(readfile(test_dir + name));
+		}
+		return ret;
+	}
+
+	const char* words[] = {"lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit"};
+
+	// 1000 paragraphs of 100 words with some inline elements
+	sample paragraphs()
+	{
+		string html = "<html><body>";
+		for (int p = 0; p < 1000; p++)
+		{
+			html += "<p>";
+			for (int w = 0; w < 100; w++)
+			{
+				if (w % 20 == 5)		html += string("<b>") + words[(p + w) % 8] + "</b> ";
+				else if (w % 20 == 15)	html += string("<a href='#'>") + words[(p + w) % 8] + "</a> ";
+				else					html += string(words[(p + w) % 8]) + " ";
+			}
+			html += "</p>";
+		}
+		html += "</body></html>";
+		return {"paragraphs", {html}};
+	}
+
+	// 500 rows of 8 cells, the column widths depend on all cells
+	sample table()
+	{
+		string html = "<html><body><table border='1' cellpadding='2'>";
+		for (int r = 0; r < 500; r++)
+		{
+			html += "<tr>";
+			for (int c = 0; c < 8; c++)
+			{
+				html += string("<td>") + words[(r + c) % 8] + " " + words[(r * c) % 8] + "</td>";
+			}
+			html += "</tr>";
+		}
+		html += "</table></body></html>";
+		return {"table", {html}};
+	}
+
+	// 900 rules of 300 classes matched by 2000 nested divs
+	sample styled()
+	{
+		string html = "<html><head><style>";
+		for (int i = 0; i < 300; i++)
+		{
+			string n = to_string(i);
+			html += ".c" + n + " { margin: " + to_string(i % 7) + "px; padding: 2px; color: #" + to_string(100 + i % 900) + "; }";
+			html += "div.c" + n + " > span { font-weight: bold; }";
+			html += ".c" + n + ":hover span, #id" + n + " .c" + n + " { text-decoration: underline; }";
+		}
+		html += "</style></head><body>";
+		for (int i = 0; i < 1000; i++)
+		{
+			string n = to_string(i % 300);
+			html += "<div class='c" + n + "' id='id" + to_string(i) + "'><div class='c" + to_string((i * 7) % 300) + "'>";
+			html += "<span>" + string(words[i % 8]) + "</span> <em>" + words[(i + 3) % 8] + "</em></div></div>";
+		}
+		html += "</body></html>";
+		return {"styled", {html}};
+	}
+
+	const int widths[] = {320, 800, 1600};
+}
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// benchmarks
+
+static test_container container(800, 1600, test_dir);
+
+static vector<document::ptr> load_documents(const sample& smp)
+{
+	vector<document::ptr> docs;
+	for (const auto& html : smp.html)
+	{
+		docs.push_back(document::createFromString(html.c_str(), &container));
+	}
+	return docs;
+}
+
+static void bm_gumbo_parse(benchmark::State& state, const sample* smp)
+{
+	GumboOptions options = kGumboDefaultOptions;
+	options.allocator = gumbo_alloc;
+	options.deallocator = gumbo_free;
+	alloc_counter allocs;
+	for (auto _ : state)
+	{
+		for (const auto& html : smp->html)
+		{
+			GumboOutput* output = gumbo_parse_with_options(&options, html.c_str(), html.size());
+			benchmark::DoNotOptimize(output);
+			gumbo_destroy_output(&options, output);
+		}
+	}
+	allocs.report(state);
+}
+
+// the whole document::createFromString()
+static void bm_load(benchmark::State& state, const sample* smp)
+{
+	alloc_counter allocs;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(load_documents(*smp));
+	}
+	allocs.report(state);
+}
+
+// one phase of createFromString() timed by the document
+static void bm_load_phase(benchmark::State& state, const sample* smp, long long load_statistics::* phase)
+{
+	alloc_counter allocs;
+	for (auto _ : state)
+	{
+		long long ns = 0;
+		for (const auto& doc : load_documents(*smp))
+		{
+			ns += doc->get_load_statistics().*phase;
+		}
+		state.SetIterationTime(ns / 1e9);
+	}
+	allocs.report(state, "load_allocs");
+}
+
+// css::parse_stylesheet() of the <style> elements, without stylesheet_cache
+static void bm_parse_stylesheet(benchmark::State& state, const sample* smp)
+{
+	auto doc = document::createFromString("", &container);
+	vector<string> styles;
+	for (const auto& html : smp->html)
+	{
+		for (size_t pos = html.find("<style"); pos != string::npos; pos = html.find("<style", pos))
+		{
+			size_t start = html.find('>', pos);
+			size_t end = html.find("</style>", start);
+			if (start == string::npos || end == string::npos) break;
+			styles.push_back(html.substr(start + 1, end - start - 1));
+			pos = end;
+		}
+	}
+	alloc_counter allocs;
+	for (auto _ : state)
+	{
+		for (const auto& style : styles)
+		{
+			css sheet;
+			sheet.parse_stylesheet(style.c_str(), nullptr, doc, nullptr);
+			sheet.sort_selectors();
+		}
+	}
+	allocs.report(state);
+}
+
+static void bm_parse_master_css(benchmark::State& state)
+{
+	auto doc = document::createFromString("", &container);
+	alloc_counter allocs;
+	for (auto _ : state)
+	{
+		css sheet;
+		sheet.parse_stylesheet(master_css, nullptr, doc, nullptr);
+		sheet.sort_selectors();
+	}
+	allocs.report(state);
+}
+
+static void bm_render(benchmark::State& state, const sample* smp)
+{
+	auto docs = load_documents(*smp);
+	alloc_counter allocs;
+	for (auto _ : state)
+	{
+		for (const auto& doc : docs)
+		{
+			doc->render((int) state.range(0));
+		}
+	}
+	allocs.report(state);
+}
+
+// draws the first 800x1600 pixels like the render tests
+static void bm_draw(benchmark::State& state, const sample* smp)
+{
+	auto docs = load_documents(*smp);
+	for (const auto& doc : docs)
+	{
+		doc->render(container.width);
+	}
+	Bitmap bmp(container.width, container.height);
+	position clip(0, 0, container.width, container.height);
+	alloc_counter allocs;
+	for (auto _ : state)
+	{
+		for (const auto& doc : docs)
+		{
+			doc->draw((uint_ptr) &bmp, 0, 0, &clip);
+		}
+	}
+	allocs.report(state);
+}
+
+int main(int argc, char** argv)
+{
+	Font::font_dir = LITEHTML_SOURCE_DIR "/containers/test/fonts/";
+	// keep the fonts of the test container loaded between the documents
+	font_cache::instance().set_enabled(true);
+	font_cache::instance().set_max_unused(256);
+
+	static const vector<sample> samples = {render_corpus(), paragraphs(), table(), styled()};
+
+	benchmark::RegisterBenchmark("parse_stylesheet/master_css", bm_parse_master_css);
+	for (const auto& smp : samples)
+	{
+		if (smp.html.empty()) continue;
+		const sample* s = &smp;
+		benchmark::RegisterBenchmark(("gumbo_parse/" + smp.name).c_str(), bm_gumbo_parse, s);
+		benchmark::RegisterBenchmark(("create_elements/" + smp.name).c_str(), bm_load_phase, s, &load_statistics::create_elements)->UseManualTime();
+		if (any_of(smp.html.begin(), smp.html.end(), [](const string& html) { return html.find("<style") != string::npos; }))
+		{
+			benchmark::RegisterBenchmark(("parse_stylesheet/" + smp.name).c_str(), bm_parse_stylesheet, s);
+		}
+		benchmark::RegisterBenchmark(("apply_stylesheet/" + smp.name).c_str(), bm_load_phase, s, &load_statistics::apply_stylesheets)->UseManualTime();
+		benchmark::RegisterBenchmark(("compute_styles/" + smp.name).c_str(), bm_load_phase, s, &load_statistics::compute_styles)->UseManualTime();
+		benchmark::RegisterBenchmark(("load/" + smp.name).c_str(), bm_load, s);
+		auto bm = benchmark::RegisterBenchmark(("render/" + smp.name).c_str(), bm_render, s);
+		for (int width : widths)
+		{
+			bm->Arg(width);
+		}
+		benchmark::RegisterBenchmark(("draw/" + smp.name).c_str(), bm_draw, s);
+	}
+
+	benchmark::Initialize(&argc, argv);
+	if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	font_cache::instance().clear(&container);
+	return 0;
+}
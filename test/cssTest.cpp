@@ -2,6 +2,7 @@
 
 #include <assert.h>
 #include "litehtml.h"
+#include "../containers/test/test_container.h"
 using namespace litehtml;
 
 TEST(CSSTest, Url) {
@@ -162,3 +163,17 @@ TEST(CSSTest, ElementSelectorParse) {
   EXPECT_TRUE(selector.m_tag == _id("tag"));
   EXPECT_TRUE(selector.m_attrs.size() == 2);
 }
+
+TEST(CSSTest, SharedStylesheet) {
+  css::const_ptr user_css = css::create_shared("p { color: red }");
+  EXPECT_EQ(user_css->selectors().size(), 1u);
+
+  test_container container(800, 600, ".");
+  for (int i = 0; i < 2; i++) {
+    auto doc = document::createFromString("<p>text</p>", &container, document::default_master_css(), user_css);
+    auto p = doc->root()->select_one("p");
+    EXPECT_EQ(p->css().get_display(), display_block);
+    EXPECT_EQ(p->css().get_color().red, 255);
+  }
+  EXPECT_EQ(user_css.use_count(), 1);
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "../containers/test/test_container.h"
+#include "../containers/test/Bitmap.h"
+using namespace std;
+
+vector<string> find_htm_files();
+string readfile(string filename);
+extern const char* test_dir;
+
+namespace
+{
+	class counting_container : public test_container
+	{
+	public:
+		int texts = 0;
+
+		counting_container() : test_container(800, 600, test_dir) {}
+
+		void draw_text(uint_ptr hdc, const char* text, uint_ptr hFont, web_color color, const position& pos) override
+		{
+			texts++;
+		}
+	};
+
+	// the pixels inside of clip must be equal, outside of the clip the culling differs
+	bool equal_in_clip(const Bitmap& bmp1, const Bitmap& bmp2, const position& clip)
+	{
+		for(int y = clip.top(); y < clip.bottom(); y++)
+		{
+			for(int x = clip.left(); x < clip.right(); x++)
+			{
+				if(!(bmp1.get_pixel(x, y) == bmp2.get_pixel(x, y))) return false;
+			}
+		}
+		return true;
+	}
+}
+
+TEST(DisplayListTest, ReplayMatchesDraw)
+{
+	for(const auto& name : find_htm_files())
+	{
+		string html = readfile(test_dir + name);
+		test_container container(800, 1600, test_dir);
+		auto doc = document::createFromString(html.c_str(), &container);
+		doc->render(800);
+		int width = doc->content_width(), height = doc->content_height();
+
+		display_list list;
+		doc->record(list);
+
+		position clip(0, 0, width, height);
+		Bitmap drawn(width, height), replayed(width, height);
+		doc->draw((uint_ptr) &drawn, 0, 0, &clip);
+		list.replay(&container, (uint_ptr) &replayed, 0, 0, &clip);
+		EXPECT_TRUE(drawn == replayed) << name;
+
+		// scrolled, with a clip in the middle of the bitmap
+		position part(width / 4, height / 4, width / 2, height / 2);
+		Bitmap drawn_part(width, height), replayed_part(width, height);
+		doc->draw((uint_ptr) &drawn_part, -7, -height / 3, &part);
+		list.replay(&container, (uint_ptr) &replayed_part, -7, -height / 3, &part);
+		EXPECT_TRUE(equal_in_clip(drawn_part, replayed_part, part)) << name;
+	}
+}
+
+TEST(DisplayListTest, Culling)
+{
+	counting_container container;
+	string html;
+	for(int i = 0; i < 100; i++)
+	{
+		html += "<p style='height:100px; margin:0'>text</p>";
+	}
+	auto doc = document::createFromString(html.c_str(), &container);
+	doc->render(800);
+
+	display_list list;
+	doc->record(list);
+	EXPECT_FALSE(list.empty());
+	EXPECT_EQ(container.texts, 0);
+
+	list.replay(&container, 0, 0, 0, nullptr);
+	EXPECT_EQ(container.texts, 100);
+
+	container.texts = 0;
+	position clip(0, 0, 800, 250);
+	list.replay(&container, 0, 0, -5000, &clip);
+	EXPECT_EQ(container.texts, 3);
+
+	list.clear();
+	EXPECT_TRUE(list.empty());
+}
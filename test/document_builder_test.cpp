@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "litehtml.h"
+#include "../containers/test/test_container.h"
+#include "../containers/test/Bitmap.h"
+using namespace std;
+
+// defined in render_test.cpp
+extern const char* test_dir;
+vector<string> find_htm_files();
+string readfile(string filename);
+Bitmap draw(document::ptr doc, int width, int height);
+
+static string body_text(document_builder& builder)
+{
+	string text;
+	builder.get_document()->root()->select_one("body")->get_text(text);
+	return text;
+}
+
+TEST(DocumentBuilderTest, IncompleteEnd)
+{
+	test_container container(800, 600, test_dir);
+	document_builder builder(&container);
+
+	builder.append("<p>one &am", 10);
+	EXPECT_EQ(body_text(builder), "one ");
+	EXPECT_FALSE(builder.has_changes());
+
+	builder.append("p; two</p><p", 12);
+	EXPECT_TRUE(builder.has_changes());
+	EXPECT_EQ(body_text(builder), "one & two");
+
+	// "три" split inside the second character
+	const char* text = ">\xD1\x82\xD1\x80\xD0\xB8";
+	builder.append(text, 4);
+	EXPECT_EQ(body_text(builder), "one & two\xD1\x82");
+	builder.append(text + 4, 3);
+	EXPECT_EQ(body_text(builder), "one & two\xD1\x82\xD1\x80\xD0\xB8");
+
+	builder.append(" <b", 3);
+	builder.finish();
+	EXPECT_TRUE(builder.finished());
+	EXPECT_EQ(body_text(builder), "one & two\xD1\x82\xD1\x80\xD0\xB8 ");
+}
+
+// Every test/render document is received in several chunks, the intermediate documents are
+// rendered and drawn, and the final one must match the reference image.
+TEST(DocumentBuilderTest, Chunks)
+{
+	const int chunks = 3;
+	for (const auto& file : find_htm_files())
+	{
+		string filename = test_dir + file;
+		string html = readfile(filename);
+
+		int width = 800, height = 1600;
+		test_container container(width, height, test_dir);
+		document_builder builder(&container);
+
+		size_t chunk_size = html.size() / chunks + 1;
+		for (size_t pos = 0; pos < html.size(); pos += chunk_size)
+		{
+			builder.append(html.data() + pos, min(chunk_size, html.size() - pos));
+			auto doc = builder.get_document();
+			ASSERT_TRUE(doc);
+			doc->render(width);
+			draw(doc, doc->content_width(), doc->content_height());
+		}
+		builder.finish();
+
+		auto doc = builder.get_document();
+		doc->render(width);
+		Bitmap bmp = draw(doc, doc->content_width(), doc->content_height());
+		EXPECT_TRUE(bmp == Bitmap(filename + ".png")) << file;
+	}
+}
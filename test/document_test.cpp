@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+#include "litehtml.h"
+#include "litehtml/el_text.h"
+#include "../containers/test/test_container.h"
+using namespace litehtml;
+
+TEST(DocumentTest, LayoutInvalidation)
+{
+	test_container container(800, 600, ".");
+	auto doc = document::createFromString(
+		"<style>"
+		"a:hover { color: red }"
+		"b:hover { cursor: pointer }"
+		"p:hover { font-size: 40px }"
+		"</style>"
+		"<p><a>link</a> <b>bold</b> text</p>", &container);
+	EXPECT_TRUE(doc->layout_dirty());
+	doc->update_layout(800);
+	EXPECT_FALSE(doc->layout_dirty());
+	int height = doc->height();
+
+	position::vector redraw_boxes;
+	element::ptr a = doc->root()->select_one("a");
+	a->set_pseudo_class(_hover_, true);
+	EXPECT_TRUE(doc->root()->find_styles_changes(redraw_boxes));
+	EXPECT_FALSE(redraw_boxes.empty());
+	EXPECT_FALSE(doc->layout_dirty());
+	EXPECT_EQ(a->css().get_color(), web_color(255, 0, 0));
+
+	// the cursor is not drawn
+	redraw_boxes.clear();
+	element::ptr b = doc->root()->select_one("b");
+	b->set_pseudo_class(_hover_, true);
+	EXPECT_FALSE(doc->root()->find_styles_changes(redraw_boxes));
+	EXPECT_TRUE(redraw_boxes.empty());
+	EXPECT_EQ(b->css().get_cursor(), "pointer");
+	EXPECT_FALSE(doc->layout_dirty());
+
+	doc->root()->select_one("p")->set_pseudo_class(_hover_, true);
+	EXPECT_TRUE(doc->root()->find_styles_changes(redraw_boxes));
+	EXPECT_TRUE(doc->layout_dirty());
+	doc->update_layout(800);
+	EXPECT_FALSE(doc->layout_dirty());
+	EXPECT_GT(doc->height(), height);
+
+	// a new width requires a new layout
+	height = doc->height();
+	doc->update_layout(40);
+	EXPECT_GT(doc->height(), height);
+}
+
+namespace
+{
+	class upper_container : public test_container
+	{
+	public:
+		upper_container() : test_container(800, 600, ".") {}
+
+		void transform_text(string& text, text_transform tt) override
+		{
+			for (char& c : text) c = (char) toupper(c);
+		}
+	};
+}
+
+// A text node is one element, its words are laid out separately
+TEST(DocumentTest, TextRuns)
+{
+	upper_container container;
+	auto doc = document::createFromString("<p>one two  three <b>bold</b>\n</p>", &container);
+	element::ptr p = doc->root()->select_one("p");
+	ASSERT_EQ(p->children().size(), 3u);
+	auto text = std::dynamic_pointer_cast<el_text>(p->children().front());
+	ASSERT_TRUE(text);
+	// "one", " ", "two", " ", " ", "three", " "
+	ASSERT_EQ(text->segments_count(), 7);
+	EXPECT_FALSE(text->is_segment_space(0));
+	EXPECT_TRUE(text->is_segment_white_space(4));
+	EXPECT_STREQ(text->segment_text(5), "three");
+	EXPECT_GT(text->segment_width(5), text->segment_width(0));
+	string str;
+	p->get_text(str);
+	EXPECT_EQ(str, "one two  three bold\n");
+
+	// the run spans the lines of its words
+	doc->render(800);
+	int line_height = text->get_placement().height;
+	EXPECT_GT(line_height, 0);
+	doc->render(60);
+	EXPECT_GE(text->get_placement().height, line_height * 2);
+	EXPECT_LE(text->get_placement().width, 60);
+
+	// the transformed words are measured
+	doc = document::createFromString("<p style='text-transform:uppercase'>one two  three</p>", &container);
+	text = std::dynamic_pointer_cast<el_text>(doc->root()->select_one("p")->children().front());
+	EXPECT_STREQ(text->segment_text(5), "THREE");
+	EXPECT_STREQ(text->segment_text(4), " ");
+	EXPECT_EQ(text->segment_width(5), container.text_width("THREE", doc->root()->select_one("p")->css().get_font()));
+}
+
+TEST(DocumentTest, LoadStatistics)
+{
+	test_container container(800, 600, ".");
+	auto doc = document::createFromString("<style>p { color: red }</style><p>text <b>bold</b></p>", &container);
+	const load_statistics& stats = doc->get_load_statistics();
+	EXPECT_GT(stats.gumbo_parse, 0);
+	EXPECT_GT(stats.create_elements, 0);
+	EXPECT_GT(stats.apply_stylesheets, 0);
+	EXPECT_GT(stats.compute_styles, 0);
+	EXPECT_GT(stats.create_render_tree, 0);
+}
+
+// the ancestors seeded for a refreshed subtree must be removed from the filter afterwards
+TEST(DocumentTest, HoverInSeparateSubtrees)
+{
+	test_container container(800, 600, ".");
+	auto doc = document::createFromString(
+		"<style>.a span:hover { color: red } .b span:hover { color: blue }</style>"
+		"<div class='a'><span id='x'>x</span></div><div class='b'><span id='y'>y</span></div>", &container);
+	position::vector redraw_boxes;
+	element::ptr x = doc->root()->select_one("#x");
+	x->set_pseudo_class(_hover_, true);
+	EXPECT_TRUE(doc->root()->find_styles_changes(redraw_boxes));
+	EXPECT_EQ(x->css().get_color(), web_color(255, 0, 0));
+
+	element::ptr y = doc->root()->select_one("#y");
+	y->set_pseudo_class(_hover_, true);
+	EXPECT_TRUE(doc->root()->find_styles_changes(redraw_boxes));
+	EXPECT_EQ(y->css().get_color(), web_color(0, 0, 255));
+}
+
+// the style sharing candidates of a previous pass are not reused
+TEST(DocumentTest, StyleSharingAfterHover)
+{
+	test_container container(800, 600, ".");
+	auto doc = document::createFromString(
+		"<style>ul:hover { color: red } li:hover { font-weight: bold }</style>"
+		"<ul><li>one</li><li>two</li></ul>", &container);
+	position::vector redraw_boxes;
+	element::ptr ul = doc->root()->select_one("ul");
+	element::ptr li1 = doc->root()->select_one("li:first-child");
+	element::ptr li2 = doc->root()->select_one("li:last-child");
+
+	ul->set_pseudo_class(_hover_, true);
+	li2->set_pseudo_class(_hover_, true);
+	doc->root()->find_styles_changes(redraw_boxes);
+	li2->set_pseudo_class(_hover_, false);
+	li1->set_pseudo_class(_hover_, true);
+	doc->root()->find_styles_changes(redraw_boxes);
+	EXPECT_EQ(li2->css().get_color(), web_color(255, 0, 0));
+
+	ul->set_pseudo_class(_hover_, false);
+	li1->set_pseudo_class(_hover_, false);
+	doc->root()->find_styles_changes(redraw_boxes);
+	EXPECT_EQ(li1->css().get_color(), web_color(0, 0, 0));
+	EXPECT_EQ(li2->css().get_color(), web_color(0, 0, 0));
+	EXPECT_EQ(li1->css().get_font(), li2->css().get_font());
+}
+
+static string nested_tables(int depth)
+{
+	string html;
+	for (int i = 0; i < depth; i++)
+	{
+		html += "<table><tr><td>cell</td><td>";
+	}
+	html += "inner";
+	for (int i = 0; i < depth; i++)
+	{
+		html += "</td></tr></table>";
+	}
+	return html;
+}
+
+// Every table measures its cells at the minimum and maximum widths before the final layout, the
+// measured widths must be reused, otherwise the time grows exponentially with the depth.
+TEST(DocumentTest, NestedTables)
+{
+	test_container container(800, 600, ".");
+	auto doc = document::createFromString(nested_tables(1).c_str(), &container);
+	doc->render(800);
+	int height = doc->height();
+
+	const int depth = 16;
+	doc = document::createFromString(nested_tables(depth).c_str(), &container);
+	doc->render(800);
+	// every table adds 2px border-spacing and 1px padding at the top and at the bottom
+	EXPECT_EQ(doc->height(), height + (depth - 1) * 6);
+}
+
+namespace
+{
+	class null_container : public test_container
+	{
+	public:
+		null_container() : test_container(800, 600, ".") {}
+
+		void draw_text(uint_ptr hdc, const char* text, uint_ptr hFont, web_color color, const position& pos) override {}
+		void draw_background(uint_ptr hdc, const std::vector<background_paint>& bg) override {}
+		void draw_borders(uint_ptr hdc, const borders& borders, const position& draw_pos, bool root) override {}
+		void draw_list_marker(uint_ptr hdc, const list_marker& marker) override {}
+	};
+}
+
+TEST(DocumentTest, DrawCulling)
+{
+	null_container container;
+	string html;
+	for (int i = 0; i < 200; i++)
+	{
+		html += "<div><p style='height:100px; margin:0'>text <b>bold</b></p></div>";
+	}
+	html += "<div style='position:absolute; top:50px'>absolute</div>";
+	auto doc = document::createFromString(html.c_str(), &container);
+	doc->render(800);
+
+	position all(0, 0, 800, doc->height());
+	doc->draw(0, 0, 0, &all);
+	int visited = doc->get_draw_statistics().visited;
+	EXPECT_EQ(doc->get_draw_statistics().culled, 0);
+
+	// the screen at the top: the absolute box is in its ancestors ink boxes
+	position clip(0, 0, 800, 250);
+	doc->draw(0, 0, 0, &clip);
+	EXPECT_GT(doc->get_draw_statistics().culled, 0);
+	EXPECT_LT(doc->get_draw_statistics().visited * 10, visited);
+
+	// a screen in the middle
+	doc->draw(0, 0, -10000, &clip);
+	EXPECT_GT(doc->get_draw_statistics().culled, 0);
+	EXPECT_LT(doc->get_draw_statistics().visited * 10, visited);
+}
+
+TEST(DocumentTest, HitTesting)
+{
+	test_container container(800, 600, ".");
+	string html;
+	for (int i = 0; i < 100; i++)
+	{
+		html += "<p id='p" + std::to_string(i) + "' style='height:100px; margin:0'>text <b>bold</b></p>";
+	}
+	html += "<div id='float' style='float:right; width:100px; height:300px; margin-top:-1000px'></div>";
+	html += "<div id='absolute' style='position:absolute; left:0; top:5000px; width:100px; height:50px'></div>";
+	html += "<div id='fixed' style='position:fixed; right:0; top:0; width:50px; height:50px'></div>";
+	auto doc = document::createFromString(html.c_str(), &container);
+	doc->render(800);
+
+	auto id_at = [&](int x, int y, int client_y)
+		{
+			element::ptr el = doc->get_element_by_point(x, y, x, client_y);
+			return el ? string(el->get_attr("id", "")) : string("none");
+		};
+	// the paragraphs are indexed by the body, the float and the absolute box overlap them
+	EXPECT_EQ(id_at(400, 10, 10), "p0");
+	EXPECT_EQ(id_at(400, 7050, 300), "p70");
+	EXPECT_EQ(id_at(10, 9950, 300), "p99");
+	EXPECT_EQ(id_at(750, 9050, 300), "float");
+	EXPECT_EQ(id_at(50, 5020, 300), "absolute");
+	// the fixed box is found by the client coordinates at any scroll position
+	EXPECT_EQ(id_at(780, 7000, 20), "fixed");
+	EXPECT_EQ(id_at(400, 20000, 300), "none");
+
+	// the index is rebuilt after a new layout
+	doc->render(400);
+	EXPECT_EQ(id_at(350, 7050, 300), "p70");
+	EXPECT_EQ(id_at(350, 9050, 300), "float");
+}
+
+TEST(DocumentTest, PaintOrder)
+{
+	class order_container : public null_container
+	{
+	public:
+		string order;
+		void draw_text(uint_ptr hdc, const char* text, uint_ptr hFont, web_color color, const position& pos) override
+		{
+			order += text;
+			order += " ";
+		}
+	};
+	order_container container;
+	auto doc = document::createFromString(
+		"<style>#neg { position: relative; z-index: -1 } #neg:hover { z-index: 3 }</style>"
+		"<div id='pos' style='position:relative; z-index:2'>pos</div>"
+		"<div id='neg'>neg</div>"
+		"<div style='position:relative'>zero</div>"
+		"<div style='float:left'>float</div>"
+		"<span style='display:inline-block'>inline</span>"
+		"<div>block</div>", &container);
+	doc->render(800);
+	position clip(0, 0, 800, 600);
+	doc->draw(0, 0, 0, &clip);
+	EXPECT_EQ(container.order, "neg float inline block zero pos ");
+
+	// the paint order is rebuilt after the layout
+	position::vector redraw_boxes;
+	doc->root()->select_one("#neg")->set_pseudo_class(_hover_, true);
+	doc->root()->find_styles_changes(redraw_boxes);
+	doc->update_layout(800);
+	container.order.clear();
+	doc->draw(0, 0, 0, &clip);
+	EXPECT_EQ(container.order, "float inline block zero pos neg ");
+}
+
+// border-radius changes without a relayout, the clip uses the radius at the time of drawing
+TEST(DocumentTest, ClipRadiusAfterHover)
+{
+	class clip_container : public null_container
+	{
+	public:
+		int radius = -1;
+		void set_clip(const position& pos, const border_radiuses& bdr_radius) override
+		{
+			radius = bdr_radius.top_left_x;
+		}
+	};
+	clip_container container;
+	auto doc = document::createFromString(
+		"<style>div:hover { border-radius: 10px }</style>"
+		"<div style='overflow:hidden; width:100px; height:50px'>text</div>", &container);
+	doc->update_layout(800);
+	position clip(0, 0, 800, 600);
+	doc->draw(0, 0, 0, &clip);
+	EXPECT_EQ(container.radius, 0);
+
+	position::vector redraw_boxes;
+	doc->root()->select_one("div")->set_pseudo_class(_hover_, true);
+	EXPECT_TRUE(doc->root()->find_styles_changes(redraw_boxes));
+	EXPECT_FALSE(doc->layout_dirty());
+	doc->update_layout(800);
+	doc->draw(0, 0, 0, &clip);
+	EXPECT_EQ(container.radius, 10);
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "litehtml.h"
+#include "../containers/test/test_container.h"
+using namespace litehtml;
+
+namespace
+{
+	class counting_container : public test_container
+	{
+	public:
+		std::atomic<int> created{0};
+		std::atomic<int> deleted{0};
+
+		counting_container() : test_container(800, 600, ".") {}
+
+		uint_ptr create_font(const char* faceName, int size, int weight, font_style italic, unsigned int decoration, font_metrics* fm) override
+		{
+			created++;
+			return test_container::create_font(faceName, size, weight, italic, decoration, fm);
+		}
+		void delete_font(uint_ptr hFont) override
+		{
+			deleted++;
+			test_container::delete_font(hFont);
+		}
+	};
+
+	// creates a font of the cache in create_font()
+	class reentrant_container : public counting_container
+	{
+	public:
+		uint_ptr create_font(const char* faceName, int size, int weight, font_style italic, unsigned int decoration, font_metrics* fm) override
+		{
+			if(weight == 700)
+			{
+				font_descriptor descr;
+				descr.name = faceName;
+				descr.size = size;
+				font_cache::instance().get(this, descr);
+				font_cache::instance().release(this, descr);
+			}
+			return counting_container::create_font(faceName, size, weight, italic, decoration, fm);
+		}
+	};
+
+	const char* html = "<p>text <b>bold</b> <u style='font-size:20px'>underline</u></p>";
+
+	class shared_fonts
+	{
+	public:
+		shared_fonts()	{ font_cache::instance().set_enabled(true); }
+		~shared_fonts()	{ font_cache::instance().set_enabled(false); }
+	};
+}
+
+TEST(FontCacheTest, Descriptor)
+{
+	EXPECT_EQ(font_descriptor::get_weight(font_weight_normal), 400);
+	EXPECT_EQ(font_descriptor::get_weight(font_weight_bold), 700);
+	EXPECT_EQ(font_descriptor::get_weight(font_weight_lighter), 300);
+	EXPECT_EQ(font_descriptor::get_decoration("none"), font_decoration_none);
+	EXPECT_EQ(font_descriptor::get_decoration(nullptr), font_decoration_none);
+	EXPECT_EQ(font_descriptor::get_decoration(" Underline  line-through"), font_decoration_underline | font_decoration_linethrough);
+	EXPECT_EQ(font_descriptor::get_decoration("overline underlined"), font_decoration_overline);
+
+	font_descriptor descr;
+	descr.name = "serif";
+	descr.size = 16;
+	font_descriptor bold = descr;
+	bold.weight = 700;
+	EXPECT_FALSE(descr == bold);
+	bold.weight = 400;
+	EXPECT_TRUE(descr == bold);
+	EXPECT_EQ(font_descriptor_hash()(descr), font_descriptor_hash()(bold));
+}
+
+TEST(FontCacheTest, PerDocumentByDefault)
+{
+	EXPECT_FALSE(font_cache::instance().enabled());
+	counting_container container;
+	auto doc1 = document::createFromString(html, &container);
+	int fonts = container.created;
+	EXPECT_GT(fonts, 0);
+
+	auto doc2 = document::createFromString(html, &container);
+	EXPECT_EQ(container.created, 2 * fonts);
+	doc1 = nullptr;
+	EXPECT_EQ(container.deleted, fonts);
+	doc2 = nullptr;
+	EXPECT_EQ(container.deleted, 2 * fonts);
+}
+
+TEST(FontCacheTest, SharedBetweenDocuments)
+{
+	shared_fonts sharing;
+	counting_container container;
+	auto doc1 = document::createFromString(html, &container);
+	int fonts = container.created;
+	EXPECT_GT(fonts, 0);
+
+	// the second document of the container uses the same fonts
+	auto doc2 = document::createFromString(html, &container);
+	EXPECT_EQ(container.created, fonts);
+	EXPECT_EQ(doc1->root()->select_one("b")->css().get_font(), doc2->root()->select_one("b")->css().get_font());
+
+	// another container has its own fonts
+	counting_container other;
+	auto doc3 = document::createFromString(html, &other);
+	EXPECT_EQ(other.created, fonts);
+	doc3 = nullptr;
+	EXPECT_EQ(other.deleted, fonts);
+
+	doc1 = nullptr;
+	EXPECT_EQ(container.deleted, 0);
+	doc2 = nullptr;
+	EXPECT_EQ(container.deleted, fonts);
+}
+
+TEST(FontCacheTest, UnusedFonts)
+{
+	shared_fonts sharing;
+	counting_container container;
+	font_cache& cache = font_cache::instance();
+	cache.set_max_unused(100);
+	auto stats = cache.get_statistics();
+
+	auto doc = document::createFromString(html, &container);
+	int fonts = container.created;
+	doc = nullptr;
+	EXPECT_EQ(container.deleted, 0);
+	EXPECT_EQ(cache.get_statistics().unused, stats.unused + fonts);
+
+	// the unused fonts are taken by the next document
+	doc = document::createFromString(html, &container);
+	EXPECT_EQ(container.created, fonts);
+	EXPECT_EQ(cache.get_statistics().hits, stats.hits + fonts);
+	doc = nullptr;
+
+	// the least recently used font is deleted first
+	cache.set_max_unused(stats.unused + fonts - 1);
+	EXPECT_EQ(container.deleted, 1);
+
+	cache.clear(&container);
+	EXPECT_EQ(container.deleted, fonts);
+	EXPECT_EQ(cache.get_statistics().unused, stats.unused);
+
+	cache.set_max_unused(font_cache::default_max_unused);
+}
+
+// create_font() and delete_font() are called without the lock of the cache
+TEST(FontCacheTest, Reentrant)
+{
+	shared_fonts sharing;
+	reentrant_container container;
+	auto doc = document::createFromString(html, &container);
+	EXPECT_GT(container.created, 0);
+	doc = nullptr;
+	EXPECT_EQ(container.deleted, container.created);
+}
+
+TEST(FontCacheTest, Threads)
+{
+	shared_fonts sharing;
+	counting_container container;
+	int fonts;
+	{
+		auto doc = document::createFromString(html, &container);
+		fonts = container.created;
+		std::vector<std::thread> threads;
+		for(int i = 0; i < 8; i++)
+		{
+			threads.emplace_back([&container]
+			{
+				for(int j = 0; j < 20; j++)
+				{
+					document::createFromString(html, &container);
+				}
+			});
+		}
+		for(auto& thread : threads)
+		{
+			thread.join();
+		}
+		// doc keeps the fonts
+		EXPECT_EQ(container.created, fonts);
+	}
+	EXPECT_EQ(container.deleted, fonts);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "litehtml/object_pool.h"
+using namespace litehtml;
+
+TEST(ObjectPoolTest, Reuse)
+{
+	void* p1 = object_pool::allocate(40);
+	void* p2 = object_pool::allocate(40);
+	EXPECT_NE(p1, p2);
+	object_pool::deallocate(p1, 40);
+	// the sizes of one list share the freed blocks
+	EXPECT_EQ(object_pool::allocate(48), p1);
+	object_pool::deallocate(p2, 40);
+	void* p3 = object_pool::allocate(16);
+	EXPECT_NE(p3, p2);
+	EXPECT_EQ(object_pool::allocate(33), p2);
+	object_pool::deallocate(p1, 48);
+	object_pool::deallocate(p2, 33);
+	object_pool::deallocate(p3, 16);
+
+	void* big = object_pool::allocate(object_pool::max_object_size + 1);
+	object_pool::deallocate(big, object_pool::max_object_size + 1);
+	object_pool::deallocate(nullptr, 40);
+}
+
+TEST(ObjectPoolTest, Threads)
+{
+	// the blocks allocated in one thread can be freed in another one
+	void* p = object_pool::allocate(64);
+	std::thread thread([p]()
+		{
+			object_pool::deallocate(p, 64);
+			EXPECT_EQ(object_pool::allocate(64), p);
+			object_pool::deallocate(p, 64);
+		});
+	thread.join();
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include "../containers/test/test_container.h"
+using namespace std;
+
+vector<string> find_htm_files();
+string readfile(string filename);
+extern const char* test_dir;
+
+namespace
+{
+	// the words are prefixed with "w:", the spaces with "s:"
+	vector<string> split(const char* text)
+	{
+		vector<string> spans;
+		test_container container(800, 600, ".");
+		container.split_text(text,
+			[&spans](tstring_view word) { spans.push_back("w:" + string(word.data(), word.size())); },
+			[&spans](tstring_view space) { spans.push_back("s:" + string(space.data(), space.size())); });
+		return spans;
+	}
+
+	// the previous implementation through wchar_t, every word is converted back to UTF-8
+	void split_text_wchar(const char* text, const function<void(const char*)>& on_word, const function<void(const char*)>& on_space)
+	{
+		wstring str;
+		wstring str_in = (const wchar_t*) utf8_to_wchar(text);
+		for(wchar_t c : str_in)
+		{
+			if(c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f')
+			{
+				if(!str.empty()) on_word(wchar_to_utf8(str));
+				str = c;
+				on_space(wchar_to_utf8(str));
+				str.clear();
+			} else if(c >= 0x4E00 && c <= 0x9FCC)
+			{
+				if(!str.empty()) on_word(wchar_to_utf8(str));
+				str = c;
+				on_word(wchar_to_utf8(str));
+				str.clear();
+			} else
+			{
+				str += c;
+			}
+		}
+		if(!str.empty()) on_word(wchar_to_utf8(str));
+	}
+
+	vector<string> split_wchar(const char* text)
+	{
+		vector<string> spans;
+		split_text_wchar(text,
+			[&spans](const char* word) { spans.push_back("w:" + string(word)); },
+			[&spans](const char* space) { spans.push_back("s:" + string(space)); });
+		return spans;
+	}
+}
+
+TEST(SplitTextTest, Spans)
+{
+	EXPECT_EQ(split(""), vector<string>());
+	EXPECT_EQ(split("word"), vector<string>({"w:word"}));
+	EXPECT_EQ(split(" two  words\n"), vector<string>({"s: ", "w:two", "s: ", "s: ", "w:words", "s:\n"}));
+	EXPECT_EQ(split("a long word without spaces\tend"),
+		vector<string>({"w:a", "s: ", "w:long", "s: ", "w:word", "s: ", "w:without", "s: ", "w:spaces", "s:\t", "w:end"}));
+	// control characters other than white space are a part of the word
+	EXPECT_EQ(split("a\x01" "b\r\fc"), vector<string>({"w:a\x01" "b", "s:\r", "s:\f", "w:c"}));
+	// every CJK ideograph is a word, other non-ASCII characters are not
+	EXPECT_EQ(split(u8"caf\u00e9 \u4e2d\u6587abc\u9fcc\u9fcd"), vector<string>({u8"w:caf\u00e9", "s: ", u8"w:\u4e2d", u8"w:\u6587", "w:abc", u8"w:\u9fcc", u8"w:\u9fcd"}));
+	EXPECT_EQ(split(u8"\u3042\u3044 \U0001F600x"), vector<string>({u8"w:\u3042\u3044", "s: ", u8"w:\U0001F600x"}));
+}
+
+TEST(SplitTextTest, MatchesWcharSplit)
+{
+	for(const auto& name : find_htm_files())
+	{
+		string html = readfile(test_dir + name);
+		EXPECT_EQ(split(html.c_str()), split_wchar(html.c_str())) << name;
+	}
+}
+
+// Throughput benchmark, run with --gtest_also_run_disabled_tests --gtest_filter=SplitTextTest.*
+TEST(SplitTextTest, DISABLED_Throughput)
+{
+	string corpus;
+	for(const auto& name : find_htm_files())
+	{
+		corpus += readfile(test_dir + name);
+	}
+	string cjk;
+	while(cjk.size() < corpus.size())
+	{
+		cjk += u8"\u6f22\u5b57\u306e\u6587\u7ae0 \u4e2d\u6587\u6bb5\u843d\u3002";
+	}
+
+	test_container container(800, 600, ".");
+	for(const string* text : {&corpus, &cjk})
+	{
+		const int passes = 20;
+		size_t spans = 0;
+		auto start = chrono::steady_clock::now();
+		for(int i = 0; i < passes; i++)
+		{
+			container.split_text(text->c_str(), [&spans](tstring_view) { spans++; }, [&spans](tstring_view) { spans++; });
+		}
+		double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+		size_t wchar_spans = 0;
+		auto wchar_start = chrono::steady_clock::now();
+		for(int i = 0; i < passes; i++)
+		{
+			split_text_wchar(text->c_str(), [&wchar_spans](const char*) { wchar_spans++; }, [&wchar_spans](const char*) { wchar_spans++; });
+		}
+		double wchar_sec = chrono::duration<double>(chrono::steady_clock::now() - wchar_start).count();
+
+		EXPECT_EQ(spans, wchar_spans);
+		printf("%s: %.0f MB/s, through wchar_t: %.0f MB/s\n", text == &corpus ? "test corpus" : "CJK",
+			text->size() * passes / sec / 1e6, text->size() * passes / wchar_sec / 1e6);
+	}
+}
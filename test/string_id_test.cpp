@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include "litehtml.h"
+
+using namespace litehtml;
+
+TEST(StringIdTest, Builtin)
+{
+	EXPECT_TRUE(_id("a") == _a_);
+	EXPECT_TRUE(_id("border-color") == _border_color_);
+	EXPECT_TRUE(_id("caption-side") == _caption_side_);
+	EXPECT_TRUE(_s(_border_color_) == "border-color");
+	EXPECT_TRUE(_s(empty_id) == "");
+	EXPECT_TRUE(_s(star_id) == "*");
+}
+
+TEST(StringIdTest, Dynamic)
+{
+	string_id id = _id("string-id-test-name");
+	EXPECT_TRUE(_id("string-id-test-name") == id);
+	EXPECT_TRUE(_s(id) == "string-id-test-name");
+	EXPECT_TRUE(_id("string-id-test-name2") != id);
+}
+
+TEST(StringIdTest, Threads)
+{
+	const int names_count = 10000;
+	std::vector<string_id> ids[4];
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++)
+	{
+		threads.emplace_back([&ids, t]()
+			{
+				for (int i = 0; i < names_count; i++)
+				{
+					string_id id = _id("thread-name-" + std::to_string(i));
+					if (_s(id) != "thread-name-" + std::to_string(i)) break;
+					ids[t].push_back(id);
+				}
+			});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	for (int t = 0; t < 4; t++)
+	{
+		EXPECT_TRUE(ids[t] == ids[0]);
+	}
+	EXPECT_EQ(names_count, (int) ids[0].size());
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "litehtml.h"
+#include "litehtml/stylesheet_cache.h"
+#include "../containers/test/test_container.h"
+using namespace litehtml;
+
+namespace
+{
+	class screen_container : public test_container
+	{
+	public:
+		int		screen_width = 800;
+		string	imported_css;	// the text of every @import
+		string	named_color;	// resolve_color() of every unknown color name
+
+		screen_container() : test_container(800, 600, ".") {}
+
+		void get_media_features(media_features& media) const override
+		{
+			media.type = media_type_screen;
+			media.width = media.device_width = screen_width;
+			media.height = media.device_height = 600;
+		}
+
+		void import_css(string& text, const string& /*url*/, string& /*baseurl*/) override
+		{
+			text = imported_css;
+		}
+
+		string resolve_color(const string& /*color*/) const override
+		{
+			return named_color;
+		}
+	};
+
+	int paragraph_red(screen_container& container, const char* html)
+	{
+		auto doc = document::createFromString(html, &container);
+		return doc->root()->select_one("p")->css().get_color().red;
+	}
+
+	class cached_stylesheets
+	{
+	public:
+		cached_stylesheets()	{ stylesheet_cache::instance().set_enabled(true); }
+		~cached_stylesheets()	{ stylesheet_cache::instance().set_enabled(false); }
+	};
+}
+
+TEST(StylesheetCacheTest, DisabledByDefault)
+{
+	stylesheet_cache& cache = stylesheet_cache::instance();
+	EXPECT_FALSE(cache.enabled());
+	cache.clear();
+	screen_container container;
+	container.imported_css = "p { color: #100000 }";
+
+	const char* import = "<style>@import url(style.css);</style><p>text</p>";
+	EXPECT_EQ(paragraph_red(container, import), 0x10);
+	container.imported_css = "p { color: #200000 }";
+	EXPECT_EQ(paragraph_red(container, import), 0x20);
+	auto stats = cache.get_statistics();
+	EXPECT_EQ(stats.hits, 0);
+	EXPECT_EQ(stats.entries, 0);
+}
+
+TEST(StylesheetCacheTest, HitsAndMedia)
+{
+	cached_stylesheets caching;
+	stylesheet_cache& cache = stylesheet_cache::instance();
+	cache.clear();
+	screen_container container;
+
+	const char* html = "<style>p { color: #100000 } @media (max-width: 500px) { p { color: #200000 } }</style><p>text</p>";
+	EXPECT_EQ(paragraph_red(container, html), 0x10);
+	container.screen_width = 400;
+	EXPECT_EQ(paragraph_red(container, html), 0x20);
+	container.screen_width = 800;
+	EXPECT_EQ(paragraph_red(container, html), 0x10);
+
+	auto stats = cache.get_statistics();
+	EXPECT_EQ(stats.misses, 1);
+	EXPECT_EQ(stats.hits, 2);
+	EXPECT_EQ(stats.entries, 1);
+
+	// the cached rules keep the order of the stylesheets in the document
+	const char* two_sheets = "<style>p { color: #300000 }</style><style>p { color: #100000 }</style><p>text</p>";
+	EXPECT_EQ(paragraph_red(container, two_sheets), 0x10);
+	EXPECT_EQ(paragraph_red(container, two_sheets), 0x10);
+	EXPECT_EQ(cache.get_statistics().hits, 4);
+	cache.clear();
+}
+
+TEST(StylesheetCacheTest, Eviction)
+{
+	cached_stylesheets caching;
+	stylesheet_cache& cache = stylesheet_cache::instance();
+	cache.clear();
+	screen_container container;
+	size_t max_size = cache.max_size();
+
+	string sheet1 = "p { color: #100000 }";
+	string sheet2 = "p { color: #200000 }";
+	cache.set_max_size(sheet1.size() + sheet2.size() / 2);
+
+	paragraph_red(container, ("<style>" + sheet1 + "</style><p>text</p>").c_str());
+	paragraph_red(container, ("<style>" + sheet2 + "</style><p>text</p>").c_str());
+	auto stats = cache.get_statistics();
+	EXPECT_EQ(stats.entries, 1);
+	EXPECT_EQ(stats.evictions, 1);
+	EXPECT_EQ(stats.size, sheet2.size());
+
+	EXPECT_EQ(paragraph_red(container, ("<style>" + sheet2 + "</style><p>text</p>").c_str()), 0x20);
+	EXPECT_EQ(cache.get_statistics().hits, 1);
+
+	cache.set_max_size(0);
+	EXPECT_EQ(cache.get_statistics().entries, 0);
+	EXPECT_EQ(paragraph_red(container, ("<style>" + sheet2 + "</style><p>text</p>").c_str()), 0x20);
+	EXPECT_EQ(cache.get_statistics().hits, 1);
+
+	cache.set_max_size(max_size);
+	cache.clear();
+}
+
+// the parsed rules depend on import_css() and resolve_color() of the container
+TEST(StylesheetCacheTest, Containers)
+{
+	cached_stylesheets caching;
+	stylesheet_cache& cache = stylesheet_cache::instance();
+	cache.clear();
+	screen_container container1;
+	screen_container container2;
+	container1.imported_css = "p { color: #100000 }";
+	container2.imported_css = "p { color: #200000 }";
+
+	const char* import = "<style>@import url(style.css);</style><p>text</p>";
+	EXPECT_EQ(paragraph_red(container1, import), 0x10);
+	EXPECT_EQ(paragraph_red(container2, import), 0x20);
+	EXPECT_EQ(paragraph_red(container1, import), 0x10);
+	EXPECT_EQ(cache.get_statistics().hits, 1);
+
+	container1.named_color = "#300000";
+	container2.named_color = "#400000";
+	const char* named = "<style>p { color: brand }</style><p>text</p>";
+	EXPECT_EQ(paragraph_red(container1, named), 0x30);
+	EXPECT_EQ(paragraph_red(container2, named), 0x40);
+
+	cache.clear(&container1);
+	cache.clear(&container2);
+	EXPECT_EQ(cache.get_statistics().entries, 0);
+}
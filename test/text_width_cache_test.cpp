@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "litehtml.h"
+#include "../containers/test/test_container.h"
+using namespace litehtml;
+
+namespace
+{
+	class counting_container : public test_container
+	{
+	public:
+		int calls = 0;
+
+		counting_container() : test_container(800, 600, ".") {}
+
+		int text_width(const char* text, uint_ptr hFont) override
+		{
+			calls++;
+			return test_container::text_width(text, hFont);
+		}
+	};
+
+	class batching_container : public counting_container
+	{
+	public:
+		int batches = 0;
+		int items = 0;
+
+		void text_widths(std::vector<text_measurement>& texts) override
+		{
+			batches++;
+			items += (int) texts.size();
+			counting_container::text_widths(texts);
+		}
+	};
+}
+
+TEST(TextWidthCacheTest, Hits)
+{
+	counting_container container;
+	auto doc = document::createFromString(
+		"<style>p:hover { color: red }</style>"
+		"<p>word word word <b>word</b></p><p>word other</p>", &container);
+	// "word", " " and "other" with the regular font, "word" with the bold font
+	EXPECT_EQ(container.calls, 4);
+	auto stats = doc->get_text_width_cache().get_statistics();
+	EXPECT_EQ(stats.misses, 4);
+	EXPECT_EQ(stats.entries, 4);
+
+	doc->render(800);
+	int width = doc->root()->select_one("b")->children().front()->get_placement().width;
+
+	// the styles computed again after :hover measure nothing
+	position::vector redraw_boxes;
+	doc->root()->select_one("p")->set_pseudo_class(_hover_, true);
+	EXPECT_TRUE(doc->root()->find_styles_changes(redraw_boxes));
+	EXPECT_EQ(container.calls, 4);
+	EXPECT_GT(doc->get_text_width_cache().get_statistics().hits, 0);
+	doc->render(800);
+	EXPECT_EQ(doc->root()->select_one("b")->children().front()->get_placement().width, width);
+}
+
+TEST(TextWidthCacheTest, Eviction)
+{
+	text_width_cache cache;
+	cache.set_max_entries(2);
+
+	int width;
+	cache.add(1, "one", 10);
+	cache.add(1, "two", 20);
+	EXPECT_TRUE(cache.find(1, "one", width));
+	EXPECT_EQ(width, 10);
+	EXPECT_FALSE(cache.find(2, "one", width));
+
+	// "two" is the least recently used
+	cache.add(1, "three", 30);
+	EXPECT_FALSE(cache.find(1, "two", width));
+	EXPECT_TRUE(cache.find(1, "one", width));
+	EXPECT_TRUE(cache.find(1, "three", width));
+	EXPECT_EQ(width, 30);
+
+	auto stats = cache.get_statistics();
+	EXPECT_EQ(stats.entries, 2);
+	EXPECT_EQ(stats.evictions, 1);
+	EXPECT_EQ(stats.hits, 3);
+	EXPECT_EQ(stats.misses, 2);
+
+	cache.set_max_entries(0);
+	EXPECT_EQ(cache.get_statistics().entries, 0);
+	cache.add(1, "one", 10);
+	EXPECT_FALSE(cache.find(1, "one", width));
+}
+
+TEST(TextWidthCacheTest, Batches)
+{
+	batching_container container;
+	auto doc = document::createFromString(
+		"<style>p:hover { font-weight: bold }</style>"
+		"<p>word word <b>word</b> other</p><p>word</p>", &container);
+	// all texts of the document are measured at once
+	EXPECT_EQ(container.batches, 1);
+	EXPECT_EQ(container.items, 4);
+	EXPECT_EQ(container.calls, 4);
+
+	doc->render(800);
+	auto b = doc->root()->select_one("b");
+	int width = b->children().front()->get_placement().width;
+	EXPECT_GT(width, 0);
+
+	// the bold texts of the :hover subtree are measured with the second batch
+	position::vector redraw_boxes;
+	doc->root()->select_one("p")->set_pseudo_class(_hover_, true);
+	EXPECT_TRUE(doc->root()->find_styles_changes(redraw_boxes));
+	EXPECT_EQ(container.batches, 2);
+	EXPECT_EQ(container.calls, 6);
+	doc->render(800);
+	EXPECT_EQ(b->children().front()->get_placement().width, width);
+
+	// without a batch the texts are measured one by one
+	int hello = 0;
+	doc->measure_text("hello", b->css().get_font(), hello);
+	EXPECT_EQ(hello, container.text_width("hello", b->css().get_font()));
+	EXPECT_EQ(container.batches, 2);
+}
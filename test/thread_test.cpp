@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../containers/test/test_container.h"
+#include "../containers/test/Bitmap.h"
+using namespace std;
+
+// defined in render_test.cpp
+extern const char* test_dir;
+vector<string> find_htm_files();
+string readfile(string filename);
+Bitmap draw(document::ptr doc, int width, int height);
+
+// Renders every test/render document on its own thread, each with its own test_container.
+// Returns the number of documents whose image differs from the reference.
+static int render_in_parallel(const vector<string>& files, int threads_count, int passes)
+{
+	std::atomic<int> failed(0);
+	vector<thread> threads;
+	for (int t = 0; t < threads_count; t++)
+	{
+		threads.emplace_back([&, t]()
+			{
+				for (int pass = 0; pass < passes; pass++)
+				{
+					for (size_t i = t; i < files.size(); i += threads_count)
+					{
+						string filename = test_dir + files[i];
+						string html = readfile(filename);
+
+						int width = 800, height = 1600;
+						test_container container(width, height, test_dir);
+
+						auto doc = document::createFromString(html.c_str(), &container);
+						doc->render(width);
+						Bitmap bmp = draw(doc, doc->content_width(), doc->content_height());
+
+						if (bmp != Bitmap(filename + ".png"))
+						{
+							failed++;
+						}
+					}
+				}
+			});
+	}
+	for (auto& th : threads)
+	{
+		th.join();
+	}
+	return failed;
+}
+
+TEST(ThreadTest, RenderInParallel)
+{
+	vector<string> files = find_htm_files();
+	EXPECT_EQ(0, render_in_parallel(files, 4, 2));
+}
+
+// Scaling benchmark, run with --gtest_also_run_disabled_tests --gtest_filter=ThreadTest.*
+TEST(ThreadTest, DISABLED_Scaling)
+{
+	vector<string> files = find_htm_files();
+	const int passes = 20;
+	printf("cores: %u\n", thread::hardware_concurrency());
+	for (int threads_count = 1; threads_count <= 8; threads_count *= 2)
+	{
+		auto start = chrono::steady_clock::now();
+		EXPECT_EQ(0, render_in_parallel(files, threads_count, passes));
+		double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+		printf("threads: %d, documents/sec: %.0f\n", threads_count, files.size() * passes / sec);
+	}
+}